@@ -0,0 +1,186 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   scope_bench.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains microbenchmarks for scope guards and \c unique_resource.
+ *
+ * Each benchmark case is timed over a fixed number of iterations and reported
+ * in nanoseconds per iteration, together with a hand-rolled baseline where
+ * applicable, so that library overhead can be tracked release to release.
+ */
+
+#include <boost/scope/scope_exit.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/fd_resource_traits.hpp>
+#include <boost/scope/exception_checker.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <utility>
+
+namespace {
+
+//! Prevents the compiler from optimizing away a value
+template< typename T >
+BOOST_FORCEINLINE void do_not_optimize(T const& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__ ("" : : "g" (value) : "memory");
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+}
+
+//! Times \a action over \a iterations invocations and prints the per-iteration cost
+template< typename Action >
+void run_case(const char* name, std::uint64_t iterations, Action&& action)
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    // Warm up caches and let the CPU ramp up
+    for (std::uint64_t i = 0u, n = iterations / 10u; i < n; ++i)
+        action();
+
+    clock_type::time_point start = clock_type::now();
+    for (std::uint64_t i = 0u; i < iterations; ++i)
+        action();
+    clock_type::time_point finish = clock_type::now();
+
+    const double ns = static_cast< double >(std::chrono::duration_cast< std::chrono::nanoseconds >(finish - start).count());
+    std::printf("%-48s %10.3f ns/iter\n", name, ns / static_cast< double >(iterations));
+}
+
+constexpr std::uint64_t iteration_count = 10000000u;
+
+int g_counter = 0;
+
+//! A deleter that only counts invocations; keeps the benchmarks syscall-free
+struct counting_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int) const noexcept
+    {
+        ++g_counter;
+    }
+};
+
+typedef boost::scope::unique_resource< int, counting_deleter, boost::scope::fd_resource_traits > unique_int_fd;
+
+void bench_guard_construction_destruction()
+{
+    run_case("scope_exit ctor/dtor", iteration_count, []
+    {
+        int n = 0;
+        {
+            boost::scope::scope_exit< void (*)() > guard([] { ++g_counter; });
+            do_not_optimize(n);
+        }
+        do_not_optimize(n);
+    });
+
+    run_case("scope_exit ctor/dtor (lambda)", iteration_count, []
+    {
+        int n = 0;
+        {
+            auto guard = boost::scope::make_scope_exit([&n]() noexcept { ++n; });
+            do_not_optimize(n);
+        }
+        do_not_optimize(n);
+    });
+
+    run_case("hand-rolled cleanup (baseline)", iteration_count, []
+    {
+        int n = 0;
+        do_not_optimize(n);
+        ++n;
+        do_not_optimize(n);
+    });
+}
+
+void bench_unique_resource_reset()
+{
+    run_case("unique_resource::reset()", iteration_count, []
+    {
+        unique_int_fd fd(10);
+        fd.reset(20);
+        do_not_optimize(fd.get());
+    });
+
+    run_case("raw int + manual close (baseline)", iteration_count, []
+    {
+        int fd = 10;
+        counting_deleter()(fd);
+        fd = 20;
+        counting_deleter()(fd);
+        do_not_optimize(fd);
+    });
+}
+
+void bench_unique_resource_move()
+{
+    run_case("unique_resource move-assignment", iteration_count, []
+    {
+        unique_int_fd fd1(10);
+        unique_int_fd fd2;
+        fd2 = std::move(fd1);
+        do_not_optimize(fd2.get());
+    });
+}
+
+void bench_exception_checker()
+{
+    run_case("exception_checker ctor + call", iteration_count, []
+    {
+        boost::scope::exception_checker checker;
+        do_not_optimize(checker());
+    });
+
+    run_case("scope_fail ctor/dtor (no exception)", iteration_count, []
+    {
+        int n = 0;
+        {
+            boost::scope::scope_fail< void (*)() > guard([] { ++g_counter; });
+            do_not_optimize(n);
+        }
+        do_not_optimize(n);
+    });
+
+    run_case("try/catch (baseline)", iteration_count, []
+    {
+        int n = 0;
+        try
+        {
+            do_not_optimize(n);
+        }
+        catch (...)
+        {
+            ++n;
+        }
+        do_not_optimize(n);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    bench_guard_construction_destruction();
+    bench_unique_resource_reset();
+    bench_unique_resource_move();
+    bench_exception_checker();
+
+    do_not_optimize(g_counter);
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/allocated_deleter.hpp
+ *
+ * This header contains definition of \c allocated_deleter, an adapter that
+ * stores a fat deleter out-of-line in allocator-provided memory.
+ */
+
+#ifndef BOOST_SCOPE_ALLOCATED_DELETER_HPP_INCLUDED_
+#define BOOST_SCOPE_ALLOCATED_DELETER_HPP_INCLUDED_
+
+#include <memory>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/compact_storage.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A deleter adapter that stores the wrapped deleter in allocator-provided memory.
+ *
+ * Deleters that capture pool back-pointers, completion callbacks or telemetry
+ * tags inflate every \c unique_resource that embeds them. The adapter keeps
+ * the wrapper at one pointer (plus the allocator, which is usually empty or
+ * a single pointer itself) and constructs the wrapped deleter out-of-line in
+ * memory obtained from \c Allocator, so a per-request arena — e.g. via
+ * `std::pmr::polymorphic_allocator` — absorbs the allocation and the
+ * teardown free becomes a pointer bump in the arena.
+ *
+ * The adapter owns the out-of-line deleter and is therefore move-only; the
+ * wrapped deleter is destroyed and its storage deallocated when the adapter
+ * is destroyed. An adapter that was moved from is empty and must not be
+ * invoked.
+ *
+ * \tparam Deleter The wrapped deleter type.
+ * \tparam Allocator The allocator used for the out-of-line storage.
+ */
+template< typename Deleter, typename Allocator = std::allocator< Deleter > >
+class allocated_deleter :
+    private detail::compact_storage< typename std::allocator_traits< Allocator >::template rebind_alloc< Deleter > >
+{
+public:
+    //! Deleter result type
+    typedef void result_type;
+    //! The wrapped deleter type
+    typedef Deleter deleter_type;
+    //! The rebound allocator type
+    typedef typename std::allocator_traits< Allocator >::template rebind_alloc< Deleter > allocator_type;
+
+private:
+    typedef detail::compact_storage< allocator_type > allocator_base;
+    typedef std::allocator_traits< allocator_type > allocator_traits;
+
+private:
+    deleter_type* m_deleter;
+
+public:
+    /*!
+     * \brief Constructs the wrapped deleter in memory obtained from the allocator.
+     *
+     * \param del The deleter to store out-of-line.
+     * \param alloc The allocator providing the deleter storage.
+     *
+     * **Throws:** Whatever allocation or the deleter constructor throws. On
+     *             failure, no memory is leaked.
+     */
+    template<
+        typename D,
+        typename = typename std::enable_if<
+            std::is_constructible< deleter_type, D&& >::value &&
+            !std::is_same< typename std::remove_cv< typename std::remove_reference< D >::type >::type, allocated_deleter >::value
+        >::type
+    >
+    explicit allocated_deleter(D&& del, Allocator const& alloc = Allocator()) :
+        allocator_base(allocator_type(alloc))
+    {
+        allocator_type& a = allocator_base::get();
+        deleter_type* const p = allocator_traits::allocate(a, 1u);
+        try
+        {
+            allocator_traits::construct(a, p, static_cast< D&& >(del));
+        }
+        catch (...)
+        {
+            allocator_traits::deallocate(a, p, 1u);
+            throw;
+        }
+
+        m_deleter = p;
+    }
+
+    //! Transfers ownership of the out-of-line deleter from \a that
+    allocated_deleter(allocated_deleter&& that) noexcept :
+        allocator_base(static_cast< allocator_base&& >(that)),
+        m_deleter(that.m_deleter)
+    {
+        that.m_deleter = nullptr;
+    }
+
+    allocated_deleter(allocated_deleter const&) = delete;
+    allocated_deleter& operator= (allocated_deleter&&) = delete;
+    allocated_deleter& operator= (allocated_deleter const&) = delete;
+
+    //! Destroys the wrapped deleter and returns its storage to the allocator
+    ~allocated_deleter()
+    {
+        if (m_deleter)
+        {
+            allocator_type& a = allocator_base::get();
+            allocator_traits::destroy(a, m_deleter);
+            allocator_traits::deallocate(a, m_deleter, 1u);
+        }
+    }
+
+    /*!
+     * \brief Invokes the wrapped deleter.
+     *
+     * **Throws:** Nothing, unless the wrapped deleter throws.
+     */
+    template< typename Resource >
+    result_type operator() (Resource&& res) const
+        noexcept(noexcept(std::declval< deleter_type& >()(std::declval< Resource&& >())))
+    {
+        BOOST_ASSERT(m_deleter != nullptr);
+        (*m_deleter)(static_cast< Resource&& >(res));
+    }
+
+    //! Returns the wrapped deleter
+    deleter_type& get_deleter() const noexcept
+    {
+        BOOST_ASSERT(m_deleter != nullptr);
+        return *m_deleter;
+    }
+
+    //! Returns the allocator used for the deleter storage
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_base::get();
+    }
+};
+
+/*!
+ * \brief Creates an \c allocated_deleter storing the given deleter in allocator-provided memory.
+ *
+ * **Throws:** Whatever allocation or the deleter constructor throws.
+ */
+template< typename Deleter, typename Allocator >
+inline allocated_deleter< typename std::decay< Deleter >::type, Allocator > allocate_deleter(Deleter&& del, Allocator const& alloc)
+{
+    return allocated_deleter< typename std::decay< Deleter >::type, Allocator >(static_cast< Deleter&& >(del), alloc);
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_ALLOCATED_DELETER_HPP_INCLUDED_
@@ -0,0 +1,245 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/any_scope_exit.hpp
+ *
+ * This header contains definition of \c any_scope_exit, a type-erased
+ * scope guard with small buffer optimization.
+ */
+
+#ifndef BOOST_SCOPE_ANY_SCOPE_EXIT_HPP_INCLUDED_
+#define BOOST_SCOPE_ANY_SCOPE_EXIT_HPP_INCLUDED_
+
+#include <new>
+#include <cstddef>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/type_traits/conjunction.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+template< std::size_t BufferSize >
+class basic_any_scope_exit;
+
+namespace detail {
+
+// is_not_like is not applicable to basic_any_scope_exit because of the non-type template parameter
+template< typename T >
+struct is_not_like_basic_any_scope_exit : public std::true_type { };
+template< typename T >
+struct is_not_like_basic_any_scope_exit< T& > : public is_not_like_basic_any_scope_exit< T > { };
+template< std::size_t BufferSize >
+struct is_not_like_basic_any_scope_exit< basic_any_scope_exit< BufferSize > > : public std::false_type { };
+template< std::size_t BufferSize >
+struct is_not_like_basic_any_scope_exit< const basic_any_scope_exit< BufferSize > > : public std::false_type { };
+template< std::size_t BufferSize >
+struct is_not_like_basic_any_scope_exit< volatile basic_any_scope_exit< BufferSize > > : public std::false_type { };
+template< std::size_t BufferSize >
+struct is_not_like_basic_any_scope_exit< const volatile basic_any_scope_exit< BufferSize > > : public std::false_type { };
+
+} // namespace detail
+
+/*!
+ * \brief Type-erased scope guard with small buffer optimization.
+ *
+ * Stores a scope exit action of an arbitrary type behind a uniform,
+ * non-template interface, so guards can be kept in containers and passed
+ * across plugin boundaries. Actions no larger than \a BufferSize whose move
+ * constructor is non-throwing are stored in an inline buffer; larger or
+ * potentially-throwing actions are allocated on the heap. Invocation goes
+ * through a single function pointer.
+ *
+ * The guard is move-only and supports the same activation interface as
+ * \c scope_exit: the action is invoked on destruction if the guard is
+ * active, and moving from a guard transfers the action and deactivates the
+ * source.
+ *
+ * \tparam BufferSize Size of the inline action buffer, in bytes.
+ */
+template< std::size_t BufferSize = 3u * sizeof(void*) >
+class basic_any_scope_exit
+{
+private:
+    enum class operation
+    {
+        invoke,     //!< Invoke the stored action
+        move,       //!< Move the stored action into the other storage and destroy the source
+        destroy     //!< Destroy the stored action
+    };
+
+    typedef typename std::aligned_storage< BufferSize >::type storage_type;
+    typedef void (*manager_func_type)(storage_type* self, storage_type* other, operation op);
+
+    //! Manager for actions stored in the inline buffer
+    template< typename Func >
+    struct inline_manager
+    {
+        static void manage(storage_type* self, storage_type* other, operation op)
+        {
+            Func* const func = reinterpret_cast< Func* >(self);
+            switch (op)
+            {
+            case operation::invoke:
+                (*func)();
+                break;
+
+            case operation::move:
+                new (static_cast< void* >(other)) Func(static_cast< Func&& >(*func));
+                func->~Func();
+                break;
+
+            case operation::destroy:
+                func->~Func();
+                break;
+            }
+        }
+    };
+
+    //! Manager for heap-allocated actions; the buffer stores the pointer
+    template< typename Func >
+    struct heap_manager
+    {
+        static void manage(storage_type* self, storage_type* other, operation op)
+        {
+            Func* const func = *reinterpret_cast< Func** >(self);
+            switch (op)
+            {
+            case operation::invoke:
+                (*func)();
+                break;
+
+            case operation::move:
+                *reinterpret_cast< Func** >(other) = func;
+                break;
+
+            case operation::destroy:
+                delete func;
+                break;
+            }
+        }
+    };
+
+    template< typename Func >
+    using use_inline_storage = detail::conjunction<
+        std::integral_constant< bool, sizeof(Func) <= BufferSize && alignof(Func) <= alignof(storage_type) >,
+        std::is_nothrow_move_constructible< Func >
+    >;
+
+private:
+    storage_type m_storage;
+    manager_func_type m_manager;
+    bool m_active;
+
+public:
+    //! Constructs an empty, inactive guard
+    basic_any_scope_exit() noexcept :
+        m_manager(nullptr),
+        m_active(false)
+    {
+    }
+
+    /*!
+     * \brief Constructs the guard with the given action.
+     *
+     * \param func The scope exit action.
+     * \param active Indicates whether the guard should be active upon construction.
+     *
+     * **Throws:** \c std::bad_alloc if the action does not fit in the inline
+     *             buffer and heap allocation fails, and any exception thrown
+     *             by the copy/move constructor of the action.
+     */
+    template<
+        typename Func,
+        typename = typename std::enable_if<
+            detail::is_not_like_basic_any_scope_exit< Func >::value
+        >::type
+    >
+    basic_any_scope_exit(Func&& func, bool active = true) :
+        m_active(false)
+    {
+        construct(static_cast< Func&& >(func), use_inline_storage< typename std::decay< Func >::type >());
+        m_active = active;
+    }
+
+    //! Moves the action from \a that and deactivates \a that
+    basic_any_scope_exit(basic_any_scope_exit&& that) noexcept :
+        m_manager(that.m_manager),
+        m_active(that.m_active)
+    {
+        if (m_manager != nullptr)
+            m_manager(&that.m_storage, &m_storage, operation::move);
+        that.m_manager = nullptr;
+        that.m_active = false;
+    }
+
+    basic_any_scope_exit(basic_any_scope_exit const&) = delete;
+    basic_any_scope_exit& operator= (basic_any_scope_exit&&) = delete;
+    basic_any_scope_exit& operator= (basic_any_scope_exit const&) = delete;
+
+    //! If active, invokes the stored action
+    ~basic_any_scope_exit()
+    {
+        if (m_manager != nullptr)
+        {
+            if (BOOST_LIKELY(m_active))
+                m_manager(&m_storage, nullptr, operation::invoke);
+            m_manager(&m_storage, nullptr, operation::destroy);
+        }
+    }
+
+    //! Returns \c true if the scope guard is active, otherwise \c false
+    bool active() const noexcept
+    {
+        return m_active;
+    }
+
+    /*!
+     * \brief Activates or deactivates the scope guard.
+     *
+     * An empty guard cannot be activated.
+     */
+    void set_active(bool active) noexcept
+    {
+        m_active = active && m_manager != nullptr;
+    }
+
+private:
+    //! Constructs the action in the inline buffer
+    template< typename Func >
+    void construct(Func&& func, std::true_type) noexcept(std::is_nothrow_constructible< typename std::decay< Func >::type, Func&& >::value)
+    {
+        typedef typename std::decay< Func >::type func_type;
+        new (static_cast< void* >(&m_storage)) func_type(static_cast< Func&& >(func));
+        m_manager = &inline_manager< func_type >::manage;
+    }
+
+    //! Constructs the action on the heap
+    template< typename Func >
+    void construct(Func&& func, std::false_type)
+    {
+        typedef typename std::decay< Func >::type func_type;
+        *reinterpret_cast< func_type** >(&m_storage) = new func_type(static_cast< Func&& >(func));
+        m_manager = &heap_manager< func_type >::manage;
+    }
+};
+
+//! Type-erased scope guard with the default inline buffer size
+typedef basic_any_scope_exit<> any_scope_exit;
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_ANY_SCOPE_EXIT_HPP_INCLUDED_
@@ -0,0 +1,151 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/async_unique_resource.hpp
+ *
+ * This header contains definition of \c async_unique_resource, a unique
+ * resource wrapper whose release goes through an asynchronous deleter.
+ * The header is empty when coroutines are not supported.
+ */
+
+#ifndef BOOST_SCOPE_ASYNC_UNIQUE_RESOURCE_HPP_INCLUDED_
+#define BOOST_SCOPE_ASYNC_UNIQUE_RESOURCE_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/co_scope_exit.hpp>
+
+#if defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Unique resource wrapper with an asynchronous deleter.
+ *
+ * The deleter, when invoked with the resource, returns an awaitable that
+ * completes when the resource is released (e.g. an async socket shutdown).
+ * `co_await res.async_reset()` releases the resource and suspends the
+ * calling coroutine until release completes, so many releases can proceed
+ * concurrently on one thread instead of serializing synchronous closes.
+ *
+ * As with \c co_scope_exit, the destructor cannot suspend: if the resource
+ * is still allocated on destruction, the deleter is invoked inline and the
+ * returned awaitable is discarded. Lazily-started awaitables perform no
+ * work unless awaited, so owning coroutines should release the resource
+ * with `co_await res.async_reset()` (or transfer ownership) on every path.
+ *
+ * Unlike \c unique_resource, the wrapper always tracks allocation with a
+ * flag; resource traits are not supported.
+ *
+ * \tparam Resource The resource type.
+ * \tparam AsyncDeleter The asynchronous deleter type.
+ */
+template< typename Resource, typename AsyncDeleter >
+class async_unique_resource
+{
+private:
+    Resource m_resource;
+    AsyncDeleter m_deleter;
+    bool m_allocated;
+
+public:
+    /*!
+     * \brief Constructs an unallocated wrapper.
+     */
+    async_unique_resource() noexcept(std::is_nothrow_default_constructible< Resource >::value &&
+        std::is_nothrow_default_constructible< AsyncDeleter >::value) :
+        m_resource(),
+        m_deleter(),
+        m_allocated(false)
+    {
+    }
+
+    /*!
+     * \brief Constructs a wrapper owning the given resource.
+     *
+     * \param res The resource to own.
+     * \param del The asynchronous deleter.
+     */
+    explicit async_unique_resource(Resource res, AsyncDeleter del = AsyncDeleter()) noexcept(std::is_nothrow_move_constructible< Resource >::value &&
+        std::is_nothrow_move_constructible< AsyncDeleter >::value) :
+        m_resource(static_cast< Resource&& >(res)),
+        m_deleter(static_cast< AsyncDeleter&& >(del)),
+        m_allocated(true)
+    {
+    }
+
+    //! Transfers ownership of the resource from \a that
+    async_unique_resource(async_unique_resource&& that) noexcept(std::is_nothrow_move_constructible< Resource >::value &&
+        std::is_nothrow_move_constructible< AsyncDeleter >::value) :
+        m_resource(static_cast< Resource&& >(that.m_resource)),
+        m_deleter(static_cast< AsyncDeleter&& >(that.m_deleter)),
+        m_allocated(that.m_allocated)
+    {
+        that.m_allocated = false;
+    }
+
+    async_unique_resource(async_unique_resource const&) = delete;
+    async_unique_resource& operator= (async_unique_resource&&) = delete;
+    async_unique_resource& operator= (async_unique_resource const&) = delete;
+
+    //! Synchronous backstop: if still allocated, invokes the deleter inline
+    ~async_unique_resource()
+    {
+        if (m_allocated)
+            static_cast< void >(m_deleter(m_resource));
+    }
+
+    //! Returns the owned resource
+    Resource const& get() const noexcept
+    {
+        return m_resource;
+    }
+
+    //! Returns \c true if the resource is allocated
+    bool allocated() const noexcept
+    {
+        return m_allocated;
+    }
+
+    //! Releases ownership of the resource without deallocating it
+    void release() noexcept
+    {
+        m_allocated = false;
+    }
+
+    /*!
+     * \brief Releases the resource and returns an awaitable for the release completion.
+     *
+     * The resource must be allocated when this is called. The wrapper is
+     * marked unallocated immediately; the returned awaitable completes when
+     * the deleter finishes releasing the resource.
+     */
+    auto async_reset() noexcept(noexcept(std::declval< AsyncDeleter& >()(std::declval< Resource& >())))
+    {
+        BOOST_ASSERT(m_allocated);
+        m_allocated = false;
+        return m_deleter(m_resource);
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+#endif // BOOST_SCOPE_ASYNC_UNIQUE_RESOURCE_HPP_INCLUDED_
@@ -0,0 +1,184 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/checked_scope.hpp
+ *
+ * This header contains definition of \c checked_scope type.
+ */
+
+#ifndef BOOST_SCOPE_CHECKED_SCOPE_HPP_INCLUDED_
+#define BOOST_SCOPE_CHECKED_SCOPE_HPP_INCLUDED_
+
+#include <boost/assert.hpp>
+#include <boost/core/addressof.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/uncaught_exception_count.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A scope anchor that captures the exception state once and shares it
+ *        between multiple scope guard conditions.
+ *
+ * Similarly to \c exception_checker, the anchor captures the number of uncaught
+ * exceptions on construction. Unlike \c exception_checker, which performs the
+ * capture in every scope guard, a single \c checked_scope object can serve any
+ * number of scope guards within the same scope: the condition function objects
+ * returned by `check_failure()` and `check_success()` merely reference the anchor,
+ * so attaching an additional guard costs a pointer copy instead of another
+ * query of the exception runtime.
+ *
+ * The anchor must outlive every condition function object referencing it, which
+ * is naturally the case when it is declared before the scope guards in the same
+ * scope.
+ *
+ * \note Like \c exception_checker, this facility is designed for scope guards
+ *       created on the stack and is incompatible with C++20 coroutines, fibers
+ *       and similar facilities, where the thread of execution may be suspended
+ *       and resumed in a different exception context.
+ */
+class checked_scope
+{
+private:
+    unsigned int m_uncaught_count;
+
+public:
+    /*!
+     * \brief A predicate that tests the referenced \c checked_scope for failure.
+     */
+    class failure_condition
+    {
+    public:
+        //! Predicate result type
+        typedef bool result_type;
+
+    private:
+        const checked_scope* m_scope;
+
+        friend class checked_scope;
+
+        explicit failure_condition(checked_scope const& scope) noexcept :
+            m_scope(boost::addressof(scope))
+        {
+        }
+
+    public:
+        /*!
+         * \brief Checks if an exception is being thrown from the referenced scope.
+         *
+         * **Throws:** Nothing.
+         */
+        result_type operator()() const noexcept
+        {
+            return m_scope->failed();
+        }
+    };
+
+    /*!
+     * \brief A predicate that tests the referenced \c checked_scope for success.
+     */
+    class success_condition
+    {
+    public:
+        //! Predicate result type
+        typedef bool result_type;
+
+    private:
+        const checked_scope* m_scope;
+
+        friend class checked_scope;
+
+        explicit success_condition(checked_scope const& scope) noexcept :
+            m_scope(boost::addressof(scope))
+        {
+        }
+
+    public:
+        /*!
+         * \brief Checks if the referenced scope is being left normally.
+         *
+         * **Throws:** Nothing.
+         */
+        result_type operator()() const noexcept
+        {
+            return !m_scope->failed();
+        }
+    };
+
+public:
+    /*!
+     * \brief Constructs the anchor and captures the current number of uncaught exceptions.
+     *
+     * **Throws:** Nothing.
+     */
+    checked_scope() noexcept :
+        m_uncaught_count(detail::uncaught_exception_count())
+    {
+    }
+
+    /*!
+     * \brief Checks if an exception is being thrown.
+     *
+     * **Throws:** Nothing.
+     *
+     * \returns \c true if the number of uncaught exceptions at the point of call is
+     *          greater than that at the point of construction of the anchor,
+     *          otherwise \c false.
+     */
+    bool failed() const noexcept
+    {
+        const unsigned int uncaught_count = detail::uncaught_exception_count();
+        // If this assertion fails, the anchor is likely being used in an unsupported
+        // way, where it is tested in a different scope or thread context from where
+        // it was constructed.
+        BOOST_ASSERT((uncaught_count - m_uncaught_count) <= 1u);
+        return uncaught_count > m_uncaught_count;
+    }
+
+    /*!
+     * \brief Creates a failure condition function object referencing this anchor.
+     *
+     * The returned predicate can be used as the condition of \c scope_fail and
+     * \c scope_success scope guards (the latter negates the failure condition
+     * internally). The anchor must outlive the returned predicate.
+     *
+     * **Throws:** Nothing.
+     */
+    failure_condition check_failure() const noexcept
+    {
+        return failure_condition(*this);
+    }
+
+    /*!
+     * \brief Creates a success condition function object referencing this anchor.
+     *
+     * The returned predicate can be used as the condition of \c scope_exit scope
+     * guards that should only act on normal scope exit. Note that \c scope_success
+     * expects a failure condition; use `check_failure()` with it instead.
+     * The anchor must outlive the returned predicate.
+     *
+     * **Throws:** Nothing.
+     */
+    success_condition check_success() const noexcept
+    {
+        return success_condition(*this);
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_CHECKED_SCOPE_HPP_INCLUDED_
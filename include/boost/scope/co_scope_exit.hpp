@@ -0,0 +1,175 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/co_scope_exit.hpp
+ *
+ * This header contains definition of \c co_scope_exit, a scope guard for
+ * coroutines whose cleanup action may return an awaitable. The header is
+ * empty when coroutines are not supported.
+ */
+
+#ifndef BOOST_SCOPE_CO_SCOPE_EXIT_HPP_INCLUDED_
+#define BOOST_SCOPE_CO_SCOPE_EXIT_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902l && \
+    defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902l
+#define BOOST_SCOPE_HAS_CO_SCOPE_EXIT
+#endif
+
+#if defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+#include <coroutine>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Scope guard for coroutines whose cleanup action may await.
+ *
+ * A destructor cannot suspend, so an awaitable cleanup action cannot be
+ * awaited from a plain \c scope_exit. Instead, \c co_scope_exit splits the
+ * guard in two parts: the coroutine awaits `co_await guard.leave()` on its
+ * normal and exceptional exit paths, which invokes the action and awaits
+ * the returned awaitable, and the destructor remains a synchronous backstop
+ * for paths that did not call \c leave().
+ *
+ * For actions returning `void`, `co_await guard.leave()` completes
+ * immediately and the destructor backstop is fully equivalent. For actions
+ * returning an awaitable, the destructor invokes the action and discards
+ * the returned awaitable; note that lazily-started awaitables (such as
+ * `asio::awaitable`) perform no work unless awaited, so coroutines using
+ * such actions must call \c leave() on every exit path.
+ *
+ * The activation interface matches \c scope_exit; \c leave() deactivates
+ * the guard, so the destructor does not invoke the action a second time.
+ *
+ * \tparam Func The scope exit action type.
+ */
+template< typename Func >
+class co_scope_exit
+{
+private:
+    Func m_func;
+    bool m_active;
+
+public:
+    /*!
+     * \brief Constructs the guard with the given action.
+     *
+     * \param func The scope exit action.
+     * \param active Indicates whether the guard should be active upon construction.
+     */
+    template<
+        typename F,
+        typename = typename std::enable_if<
+            std::is_constructible< Func, F&& >::value &&
+            !std::is_same< typename std::remove_cv< typename std::remove_reference< F >::type >::type, co_scope_exit >::value
+        >::type
+    >
+    explicit co_scope_exit(F&& func, bool active = true) noexcept(std::is_nothrow_constructible< Func, F&& >::value) :
+        m_func(static_cast< F&& >(func)),
+        m_active(active)
+    {
+    }
+
+    //! Moves the action from \a that and deactivates \a that
+    co_scope_exit(co_scope_exit&& that) noexcept(std::is_nothrow_move_constructible< Func >::value) :
+        m_func(static_cast< Func&& >(that.m_func)),
+        m_active(that.m_active)
+    {
+        that.m_active = false;
+    }
+
+    co_scope_exit(co_scope_exit const&) = delete;
+    co_scope_exit& operator= (co_scope_exit&&) = delete;
+    co_scope_exit& operator= (co_scope_exit const&) = delete;
+
+    //! Synchronous backstop: if still active, invokes the action inline
+    ~co_scope_exit()
+    {
+        if (BOOST_LIKELY(m_active))
+            static_cast< void >(m_func());
+    }
+
+    /*!
+     * \brief Invokes the cleanup action and returns an awaitable for its completion.
+     *
+     * Deactivates the guard. For actions returning `void`, returns an
+     * immediately-ready awaitable. For actions returning an awaitable,
+     * returns it for the calling coroutine to `co_await`; in this case the
+     * guard must still be active when \c leave() is called.
+     */
+    auto leave() noexcept(noexcept(std::declval< Func& >()()))
+    {
+        typedef decltype(m_func()) result_type;
+        if constexpr (std::is_void< result_type >::value)
+        {
+            if (BOOST_LIKELY(m_active))
+            {
+                m_active = false;
+                m_func();
+            }
+            return std::suspend_never{};
+        }
+        else
+        {
+            BOOST_ASSERT(m_active);
+            m_active = false;
+            return m_func();
+        }
+    }
+
+    //! Returns \c true if the scope guard is active, otherwise \c false
+    bool active() const noexcept
+    {
+        return m_active;
+    }
+
+    //! Activates or deactivates the scope guard
+    void set_active(bool active) noexcept
+    {
+        m_active = active;
+    }
+};
+
+template< typename Func >
+co_scope_exit(Func) -> co_scope_exit< Func >;
+
+template< typename Func >
+co_scope_exit(Func, bool) -> co_scope_exit< Func >;
+
+/*!
+ * \brief Creates a coroutine-aware scope guard with the given action.
+ *
+ * \param func The scope exit action.
+ * \param active Indicates whether the guard should be active upon construction.
+ */
+template< typename Func >
+inline co_scope_exit< typename std::decay< Func >::type > make_co_scope_exit(Func&& func, bool active = true)
+    noexcept(std::is_nothrow_constructible< co_scope_exit< typename std::decay< Func >::type >, Func, bool >::value)
+{
+    return co_scope_exit< typename std::decay< Func >::type >(static_cast< Func&& >(func), active);
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+#endif // BOOST_SCOPE_CO_SCOPE_EXIT_HPP_INCLUDED_
@@ -0,0 +1,204 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/crash_scope_exit.hpp
+ *
+ * This header contains definition of \c crash_scope_exit, a registry of
+ * cleanup actions runnable from signal handlers and other crash paths.
+ */
+
+#ifndef BOOST_SCOPE_CRASH_SCOPE_EXIT_HPP_INCLUDED_
+#define BOOST_SCOPE_CRASH_SCOPE_EXIT_HPP_INCLUDED_
+
+#include <atomic>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+//! Number of preallocated crash action slots
+#if !defined(BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY)
+#define BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY 64u
+#endif
+
+namespace boost {
+namespace scope {
+
+//! Crash action type. The argument is the context pointer given at registration.
+typedef void (*crash_scope_exit_action_t)(void* context);
+
+namespace detail {
+
+//! A single preallocated crash action slot
+struct crash_action_slot
+{
+    //! Claim token; a null owner marks a free slot. The slot stays claimed
+    //! after the action is consumed, until the owning guard is destroyed,
+    //! which rules out reuse races on the action value.
+    std::atomic< void* > owner;
+    std::atomic< crash_scope_exit_action_t > action;
+    std::atomic< void* > context;
+};
+
+//! Global crash action registry
+template< typename = void >
+struct crash_action_registry
+{
+    //! Preallocated slots
+    static crash_action_slot slots[BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY];
+    //! Rotating hint to spread registrations across the slot array
+    static std::atomic< unsigned int > next_slot;
+};
+
+template< typename Void >
+crash_action_slot crash_action_registry< Void >::slots[BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY] = {};
+template< typename Void >
+std::atomic< unsigned int > crash_action_registry< Void >::next_slot{ 0u };
+
+} // namespace detail
+
+/*!
+ * \brief Scope guard whose action can run from a signal handler.
+ *
+ * Normal scope guards rely on stack unwinding, which never happens on
+ * SIGSEGV/SIGTERM paths. \c crash_scope_exit instead registers a plain
+ * function pointer and a context pointer in a fixed-size, preallocated,
+ * lock-free registry; \c run_crash_scope_exits() executes and clears all
+ * registered actions and is async-signal-safe, so it may be called from a
+ * signal handler to drop PID files, mark shared-memory segments dirty and
+ * the like.
+ *
+ * Registration claims a free slot with one compare-and-swap and
+ * deregistration is two atomic stores — no allocation, no locking, no
+ * exceptions — which makes per-resource registration viable on hot paths.
+ * The registry holds \c BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY actions; when
+ * it is full, the guard is constructed unregistered, which can be queried
+ * with \c registered().
+ *
+ * The actions themselves must be async-signal-safe and must not throw.
+ */
+class crash_scope_exit
+{
+private:
+    //! Index of the claimed slot, or capacity if registration failed
+    unsigned int m_slot_index;
+
+public:
+    /*!
+     * \brief Registers the action in the crash action registry.
+     *
+     * \param action The cleanup action; must be async-signal-safe.
+     * \param context Opaque pointer passed to the action. The pointed-to
+     *        object must remain valid for the lifetime of the guard.
+     *
+     * **Throws:** Nothing.
+     */
+    explicit crash_scope_exit(crash_scope_exit_action_t action, void* context = nullptr) noexcept :
+        m_slot_index(BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY)
+    {
+        BOOST_ASSERT(action != nullptr);
+
+        const unsigned int hint = detail::crash_action_registry<>::next_slot
+            .fetch_add(1u, std::memory_order_relaxed);
+        for (unsigned int i = 0u; i < BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY; ++i)
+        {
+            const unsigned int index = (hint + i) % BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY;
+            detail::crash_action_slot& slot = detail::crash_action_registry<>::slots[index];
+
+            void* expected = nullptr;
+            if (slot.owner.load(std::memory_order_relaxed) == nullptr &&
+                slot.owner.compare_exchange_strong(expected, static_cast< void* >(this), std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                // The slot is exclusively ours now; publish the context
+                // before the action so that the runner never observes a
+                // registered action with a stale context
+                slot.context.store(context, std::memory_order_relaxed);
+                slot.action.store(action, std::memory_order_release);
+                m_slot_index = index;
+                break;
+            }
+        }
+    }
+
+    //! Transfers the registration from \a that
+    crash_scope_exit(crash_scope_exit&& that) noexcept :
+        m_slot_index(that.m_slot_index)
+    {
+        that.m_slot_index = BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY;
+    }
+
+    crash_scope_exit(crash_scope_exit const&) = delete;
+    crash_scope_exit& operator= (crash_scope_exit&&) = delete;
+    crash_scope_exit& operator= (crash_scope_exit const&) = delete;
+
+    /*!
+     * \brief Deregisters the action and releases the slot.
+     *
+     * The guard owns its slot for its whole lifetime, even after
+     * \c run_crash_scope_exits() has consumed the action, so the release
+     * cannot disturb a registration made by another guard.
+     */
+    ~crash_scope_exit() noexcept
+    {
+        if (BOOST_LIKELY(m_slot_index < BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY))
+        {
+            detail::crash_action_slot& slot = detail::crash_action_registry<>::slots[m_slot_index];
+            slot.action.store(nullptr, std::memory_order_relaxed);
+            slot.owner.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    //! Returns \c true if the action was registered, \c false if the registry was full
+    bool registered() const noexcept
+    {
+        return m_slot_index < BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY;
+    }
+};
+
+/*!
+ * \brief Executes and clears all registered crash actions.
+ *
+ * Each action is atomically claimed before it is invoked, so concurrent or
+ * reentrant calls (e.g. a second signal delivered during handling) execute
+ * every action at most once. The function performs no allocation and no
+ * locking and is async-signal-safe, provided the actions are.
+ *
+ * **Throws:** Nothing.
+ *
+ * \returns The number of actions executed.
+ */
+inline unsigned int run_crash_scope_exits() noexcept
+{
+    unsigned int count = 0u;
+    for (unsigned int i = 0u; i < BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY; ++i)
+    {
+        detail::crash_action_slot& slot = detail::crash_action_registry<>::slots[i];
+        if (slot.action.load(std::memory_order_relaxed) != nullptr)
+        {
+            crash_scope_exit_action_t const action = slot.action.exchange(nullptr, std::memory_order_acquire);
+            if (action != nullptr)
+            {
+                action(slot.context.load(std::memory_order_relaxed));
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_CRASH_SCOPE_EXIT_HPP_INCLUDED_
@@ -0,0 +1,209 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/deferred_deleter.hpp
+ *
+ * This header contains definition of \c deferred_cleanup_queue and
+ * \c deferred_deleter for moving expensive resource deallocation off
+ * the destructor path.
+ */
+
+#ifndef BOOST_SCOPE_DEFERRED_DELETER_HPP_INCLUDED_
+#define BOOST_SCOPE_DEFERRED_DELETER_HPP_INCLUDED_
+
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Lock-free multi-producer queue of pending resource deallocations.
+ *
+ * Producers enqueue resource+deleter pairs with a single allocation and an
+ * atomic exchange; a consumer executes the queued deleters by calling
+ * \c drain(). Any number of threads may push concurrently, but at most one
+ * thread may drain the queue at a time (typically a background reaper
+ * thread owned by the application). Entries are drained in the order they
+ * were pushed.
+ *
+ * The queue never starts threads by itself; the application decides where
+ * and when draining happens. Destroying the queue drains it.
+ */
+class deferred_cleanup_queue
+{
+private:
+    struct node
+    {
+        node* next;
+        //! Invokes the deleter on the stored resource and destroys the node
+        void (*invoke_and_destroy)(node* p);
+    };
+
+    template< typename Resource, typename Deleter >
+    struct typed_node :
+        public node
+    {
+        Resource resource;
+        Deleter deleter;
+
+        template< typename R, typename D >
+        typed_node(R&& res, D&& del) :
+            resource(static_cast< R&& >(res)),
+            deleter(static_cast< D&& >(del))
+        {
+            this->next = nullptr;
+            this->invoke_and_destroy = &typed_node::do_invoke_and_destroy;
+        }
+
+        static void do_invoke_and_destroy(node* p)
+        {
+            typed_node* const self = static_cast< typed_node* >(p);
+            self->deleter(self->resource);
+            delete self;
+        }
+    };
+
+private:
+    std::atomic< node* > m_head;
+
+public:
+    deferred_cleanup_queue() noexcept :
+        m_head(nullptr)
+    {
+    }
+
+    deferred_cleanup_queue(deferred_cleanup_queue const&) = delete;
+    deferred_cleanup_queue& operator= (deferred_cleanup_queue const&) = delete;
+
+    //! Drains the remaining entries
+    ~deferred_cleanup_queue()
+    {
+        drain();
+    }
+
+    /*!
+     * \brief Enqueues a resource to be deallocated by a later \c drain() call.
+     *
+     * If the queue node cannot be allocated, the deleter is invoked inline
+     * as a last resort, so the resource is never leaked.
+     *
+     * **Throws:** Nothing, unless copying/moving the resource or the deleter throws.
+     */
+    template< typename Resource, typename Deleter >
+    void push(Resource&& res, Deleter&& del)
+    {
+        typedef typed_node<
+            typename std::decay< Resource >::type,
+            typename std::decay< Deleter >::type
+        > node_type;
+
+        node_type* const p = new (std::nothrow) node_type(
+            static_cast< Resource&& >(res), static_cast< Deleter&& >(del));
+        if (BOOST_UNLIKELY(p == nullptr))
+        {
+            del(res);
+            return;
+        }
+
+        p->next = m_head.load(std::memory_order_relaxed);
+        while (!m_head.compare_exchange_weak(p->next, p, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /*!
+     * \brief Executes and removes all queued deallocations.
+     *
+     * Must not be called concurrently with another \c drain() on the same queue.
+     *
+     * \returns The number of entries drained.
+     */
+    std::size_t drain() noexcept
+    {
+        node* p = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        // The list comes out in reverse push order; restore FIFO order
+        node* head = nullptr;
+        while (p != nullptr)
+        {
+            node* const next = p->next;
+            p->next = head;
+            head = p;
+            p = next;
+        }
+
+        std::size_t count = 0u;
+        while (head != nullptr)
+        {
+            node* const next = head->next;
+            head->invoke_and_destroy(head);
+            head = next;
+            ++count;
+        }
+
+        return count;
+    }
+};
+
+/*!
+ * \brief Deleter adapter that defers deallocation to a \c deferred_cleanup_queue.
+ *
+ * Instead of invoking the wrapped deleter inline, the adapter enqueues the
+ * resource together with a copy of the deleter, so the destructor of the
+ * owning \c unique_resource costs one allocation and one atomic exchange
+ * regardless of how expensive the actual deallocation is. The referenced
+ * queue must outlive every resource using the adapter.
+ *
+ * \tparam Deleter The wrapped deleter type.
+ */
+template< typename Deleter >
+class deferred_deleter
+{
+public:
+    typedef void result_type;
+
+private:
+    deferred_cleanup_queue* m_queue;
+    Deleter m_deleter;
+
+public:
+    /*!
+     * \brief Constructs the adapter.
+     *
+     * \param queue Queue to defer deallocations to.
+     * \param del Deleter that performs the actual deallocation.
+     */
+    explicit deferred_deleter(deferred_cleanup_queue& queue, Deleter const& del = Deleter()) noexcept(std::is_nothrow_copy_constructible< Deleter >::value) :
+        m_queue(&queue),
+        m_deleter(del)
+    {
+    }
+
+    //! Enqueues deallocation of the resource
+    template< typename Resource >
+    result_type operator() (Resource&& res) const
+    {
+        m_queue->push(static_cast< Resource&& >(res), m_deleter);
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_DEFERRED_DELETER_HPP_INCLUDED_
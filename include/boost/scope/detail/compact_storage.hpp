@@ -52,12 +52,12 @@ public:
     compact_storage(compact_storage const&) = default;
     compact_storage& operator= (compact_storage const&) = default;
 
-    T& get() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR T& get() noexcept
     {
         return *static_cast< T* >(this);
     }
 
-    T const& get() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR T const& get() const noexcept
     {
         return *static_cast< const T* >(this);
     }
@@ -67,7 +67,9 @@ template< typename T, typename Tag >
 class compact_storage< T, Tag, false >
 {
 private:
-    T m_data;
+    // The attribute compacts empty types that cannot use the EBO path above,
+    // e.g. empty final classes, on compilers that support it
+    BOOST_SCOPE_NO_UNIQUE_ADDRESS_ATTR T m_data;
 
 public:
     template< typename... Args >
@@ -82,12 +84,12 @@ public:
     compact_storage(compact_storage const&) = default;
     compact_storage& operator= (compact_storage const&) = default;
 
-    T& get() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR T& get() noexcept
     {
         return m_data;
     }
 
-    T const& get() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR T const& get() const noexcept
     {
         return m_data;
     }
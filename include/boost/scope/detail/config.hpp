@@ -21,6 +21,112 @@
 #pragma once
 #endif
 
+/*
+ * In configurations without exception handling support, a scope_fail guard can
+ * never fire and a scope_success guard is unconditional. BOOST_SCOPE_NO_EXCEPTIONS
+ * makes exception_checker a stateless predicate that statically returns false,
+ * which allows the compiler to remove the dead condition branches from the
+ * scope guard destructors. The macro can also be defined by the user to force
+ * this mode.
+ */
+#if !defined(BOOST_SCOPE_NO_EXCEPTIONS) && defined(BOOST_NO_EXCEPTIONS)
+#define BOOST_SCOPE_NO_EXCEPTIONS
+#endif
+
+/*
+ * On architectures where functions are guaranteed to be aligned to at least
+ * 2 bytes, the lowest bit of a function pointer is free and can be used to
+ * encode the active state of a scope guard, collapsing the guard to a single
+ * machine word. This holds on AArch64, where instructions are 4-byte aligned.
+ * It does not hold on x86, which has no instruction alignment requirement and
+ * where compilers do emit functions at odd addresses, nor on 32-bit ARM,
+ * where bit 0 of a function pointer selects the Thumb instruction set.
+ * Define BOOST_SCOPE_NO_TAGGED_FUNCTION_POINTERS to suppress this
+ * optimization.
+ */
+#if !defined(BOOST_SCOPE_NO_TAGGED_FUNCTION_POINTERS) && !defined(BOOST_SCOPE_HAS_TAGGED_FUNCTION_POINTERS)
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define BOOST_SCOPE_HAS_TAGGED_FUNCTION_POINTERS
+#endif
+#endif
+
+/*
+ * BOOST_SCOPE_NO_UNIQUE_ADDRESS_ATTR expands to the [[no_unique_address]] attribute
+ * (or the MSVC-specific spelling), which allows compact storage of empty members
+ * even when the type is final and empty base optimization is not applicable.
+ * BOOST_SCOPE_HAS_NO_UNIQUE_ADDRESS is defined when the attribute is effective.
+ */
+#if !defined(BOOST_SCOPE_HAS_NO_UNIQUE_ADDRESS) && defined(__has_cpp_attribute)
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC accepts the standard attribute spelling but ignores it for ABI compatibility reasons
+#if _MSC_VER >= 1929 && __has_cpp_attribute(msvc::no_unique_address)
+#define BOOST_SCOPE_NO_UNIQUE_ADDRESS_ATTR [[msvc::no_unique_address]]
+#define BOOST_SCOPE_HAS_NO_UNIQUE_ADDRESS
+#endif
+#elif __has_cpp_attribute(no_unique_address) >= 201803
+#define BOOST_SCOPE_NO_UNIQUE_ADDRESS_ATTR [[no_unique_address]]
+#define BOOST_SCOPE_HAS_NO_UNIQUE_ADDRESS
+#endif
+#endif
+
+#if !defined(BOOST_SCOPE_NO_UNIQUE_ADDRESS_ATTR)
+#define BOOST_SCOPE_NO_UNIQUE_ADDRESS_ATTR
+#endif
+
+/*
+ * BOOST_SCOPE_FORCEINLINE is applied to the trivial accessors and destructor
+ * paths of the scope guards and unique_resource, so that unoptimized and
+ * sanitizer builds collapse the abstraction layers (compact_storage::get(),
+ * the condition functor, the action wrapper) the way optimized builds do.
+ * Define BOOST_SCOPE_NO_FORCEINLINE to suppress the forced inlining, e.g.
+ * when breakpoints on the individual layers are needed.
+ */
+#if !defined(BOOST_SCOPE_FORCEINLINE)
+#if defined(BOOST_SCOPE_NO_FORCEINLINE)
+#define BOOST_SCOPE_FORCEINLINE inline
+#else
+#define BOOST_SCOPE_FORCEINLINE BOOST_FORCEINLINE
+#endif
+#endif
+
+/*
+ * BOOST_SCOPE_COLD marks the failure and cleanup slow paths (scope guard
+ * action invocation, unique_resource deleter invocation) as cold and not
+ * inlineable, so they are emitted out of line in a cold section while the
+ * inline fast path remains a single flag check. This keeps the common no-op
+ * path dense in the instruction stream. Define BOOST_SCOPE_NO_COLD to keep
+ * the slow path bodies inline.
+ */
+#if !defined(BOOST_SCOPE_COLD)
+#if !defined(BOOST_SCOPE_NO_COLD) && (defined(__GNUC__) || defined(__clang__))
+#define BOOST_SCOPE_COLD __attribute__((cold, noinline))
+#else
+#define BOOST_SCOPE_COLD
+#endif
+#endif
+
+/*
+ * BOOST_SCOPE_PROFILE, when defined by the user, enables recording of
+ * TSC-timestamped scope guard action and unique_resource deleter invocations
+ * into per-thread lock-free ring buffers, which can be drained through
+ * boost/scope/profile.hpp. The instrumentation is compiled out entirely when
+ * the macro is not defined. See boost/scope/detail/profile.hpp.
+ */
+
+/*
+ * BOOST_SCOPE_CXX20_CONSTEXPR expands to constexpr when C++20 constexpr
+ * extensions (P1330, P0784) are available. In particular, this allows scope
+ * guard destructors to run during constant evaluation, making guard-based
+ * algorithms usable in constexpr/consteval contexts.
+ */
+#if !defined(BOOST_SCOPE_CXX20_CONSTEXPR)
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907l
+#define BOOST_SCOPE_CXX20_CONSTEXPR constexpr
+#else
+#define BOOST_SCOPE_CXX20_CONSTEXPR
+#endif
+#endif
+
 #if !defined(BOOST_SCOPE_DETAIL_DOC_HIDDEN)
 #if !defined(BOOST_SCOPE_DOXYGEN)
 #define BOOST_SCOPE_DETAIL_DOC_HIDDEN(...) __VA_ARGS__
@@ -0,0 +1,284 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/detail/profile.hpp
+ *
+ * This header contains the \c BOOST_SCOPE_PROFILE instrumentation machinery.
+ * When the macro is not defined, the instrumentation compiles away entirely.
+ */
+
+#ifndef BOOST_SCOPE_DETAIL_PROFILE_HPP_INCLUDED_
+#define BOOST_SCOPE_DETAIL_PROFILE_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if defined(BOOST_SCOPE_PROFILE)
+
+#if defined(BOOST_NO_CXX11_THREAD_LOCAL)
+#error Boost.Scope: BOOST_SCOPE_PROFILE requires thread_local support
+#endif
+
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#if !defined(BOOST_NO_RTTI)
+#include <typeinfo>
+#endif
+#include <boost/core/addressof.hpp>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+//! Number of events each per-thread ring buffer can hold; must be a power of 2
+#if !defined(BOOST_SCOPE_PROFILE_RING_CAPACITY)
+#define BOOST_SCOPE_PROFILE_RING_CAPACITY 1024u
+#endif
+
+namespace boost {
+namespace scope {
+
+//! Kind of the instrumented invocation
+enum class profile_event_kind : unsigned char
+{
+    scope_exit_action,      //!< A \c scope_exit, \c scope_fail or \c scope_success action
+    scope_final_action,     //!< A \c scope_final action
+    unique_resource_deleter //!< A \c unique_resource deleter
+};
+
+/*!
+ * \brief A single recorded invocation of a guard action or deleter.
+ *
+ * Timestamps are raw TSC (or equivalent monotonic counter) readings; the
+ * conversion to wall-clock units is platform-specific and left to the
+ * consumer.
+ */
+struct profile_event
+{
+    //! Kind of the instrumented invocation
+    profile_event_kind kind;
+    //! Address of the invoked callable object (the target for tagged function pointer guards)
+    const void* action;
+    //! Mangled type name of the callable, or "?" when RTTI is unavailable
+    const char* action_name;
+    //! Counter reading taken immediately before the invocation
+    std::uint64_t start;
+    //! Counter increment over the invocation
+    std::uint64_t duration;
+};
+
+namespace detail {
+
+//! Reads the timestamp counter
+inline std::uint64_t profile_read_tsc() noexcept
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    return __builtin_ia32_rdtsc();
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return __rdtsc();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    std::uint64_t counter;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (counter));
+    return counter;
+#else
+    return static_cast< std::uint64_t >(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+//! Returns the mangled name of the callable type, for offline attribution
+template< typename T >
+inline const char* profile_action_name() noexcept
+{
+#if !defined(BOOST_NO_RTTI)
+    return typeid(T).name();
+#else
+    return "?";
+#endif
+}
+
+//! Returns the address of the callable object
+template< typename T >
+inline const void* profile_action_address(T& action) noexcept
+{
+    return boost::addressof(action);
+}
+
+/*!
+ * \brief Single-producer ring buffer of profile events.
+ *
+ * The owning thread is the only producer; \c drain() may be called from any
+ * thread, but concurrent calls to \c drain() are not supported. When the
+ * buffer is full, new events are dropped and counted.
+ */
+class profile_ring
+{
+public:
+    enum : std::size_t { capacity = BOOST_SCOPE_PROFILE_RING_CAPACITY };
+
+private:
+    static_assert((static_cast< std::size_t >(capacity) & (static_cast< std::size_t >(capacity) - 1u)) == 0u,
+        "BOOST_SCOPE_PROFILE_RING_CAPACITY must be a power of 2");
+
+    std::atomic< std::size_t > m_produced;
+    std::atomic< std::size_t > m_consumed;
+    std::atomic< std::uint64_t > m_dropped;
+    profile_ring* m_next;
+    profile_event m_events[capacity];
+
+public:
+    profile_ring() noexcept :
+        m_produced(0u),
+        m_consumed(0u),
+        m_dropped(0u),
+        m_next(nullptr)
+    {
+    }
+
+    profile_ring(profile_ring const&) = delete;
+    profile_ring& operator= (profile_ring const&) = delete;
+
+    //! Records an event; drops it if the buffer is full
+    void push(profile_event const& event) noexcept
+    {
+        const std::size_t produced = m_produced.load(std::memory_order_relaxed);
+        if (BOOST_UNLIKELY((produced - m_consumed.load(std::memory_order_acquire)) >= static_cast< std::size_t >(capacity)))
+        {
+            m_dropped.fetch_add(1u, std::memory_order_relaxed);
+            return;
+        }
+
+        m_events[produced & (static_cast< std::size_t >(capacity) - 1u)] = event;
+        m_produced.store(produced + 1u, std::memory_order_release);
+    }
+
+    //! Invokes \a visitor for every recorded event and removes the events from the buffer
+    template< typename Visitor >
+    std::size_t drain(Visitor& visitor)
+    {
+        std::size_t consumed = m_consumed.load(std::memory_order_relaxed);
+        const std::size_t produced = m_produced.load(std::memory_order_acquire);
+        const std::size_t count = produced - consumed;
+        while (consumed != produced)
+        {
+            visitor(static_cast< profile_event const& >(m_events[consumed & (static_cast< std::size_t >(capacity) - 1u)]));
+            m_consumed.store(++consumed, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    //! Returns the number of events dropped due to buffer overflow
+    std::uint64_t dropped() const noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    //! Returns the next ring in the global list
+    profile_ring* next() const noexcept
+    {
+        return m_next;
+    }
+
+    //! Pushes the ring onto the global list
+    static void register_ring(profile_ring* ring) noexcept
+    {
+        std::atomic< profile_ring* >& head = profile_ring_list<>::head;
+        profile_ring* expected = head.load(std::memory_order_relaxed);
+        do
+        {
+            ring->m_next = expected;
+        }
+        while (!head.compare_exchange_weak(expected, ring, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    //! Returns the head of the global list of per-thread rings
+    static profile_ring* list_head() noexcept
+    {
+        return profile_ring_list<>::head.load(std::memory_order_acquire);
+    }
+
+private:
+    template< typename = void >
+    struct profile_ring_list
+    {
+        static std::atomic< profile_ring* > head;
+    };
+};
+
+template< typename Void >
+std::atomic< profile_ring* > profile_ring::profile_ring_list< Void >::head{ nullptr };
+
+/*!
+ * \brief Returns the calling thread's ring buffer, or \c nullptr on allocation failure.
+ *
+ * Rings are heap-allocated and intentionally never freed, so that draining
+ * remains safe after the owning thread has exited.
+ */
+inline profile_ring* this_thread_profile_ring() noexcept
+{
+    static thread_local profile_ring* ring = nullptr;
+    if (BOOST_UNLIKELY(!ring))
+    {
+        ring = new (std::nothrow) profile_ring();
+        if (ring)
+            profile_ring::register_ring(ring);
+    }
+
+    return ring;
+}
+
+//! Times one instrumented invocation and records it on destruction
+class profile_timer
+{
+private:
+    profile_event m_event;
+
+public:
+    profile_timer(profile_event_kind kind, const void* action, const char* action_name) noexcept
+    {
+        m_event.kind = kind;
+        m_event.action = action;
+        m_event.action_name = action_name;
+        m_event.start = profile_read_tsc();
+    }
+
+    profile_timer(profile_timer const&) = delete;
+    profile_timer& operator= (profile_timer const&) = delete;
+
+    ~profile_timer()
+    {
+        m_event.duration = profile_read_tsc() - m_event.start;
+        profile_ring* const ring = this_thread_profile_ring();
+        if (BOOST_LIKELY(!!ring))
+            ring->push(m_event);
+    }
+};
+
+} // namespace detail
+} // namespace scope
+} // namespace boost
+
+#define BOOST_SCOPE_DETAIL_PROFILE_INVOCATION(kind, action, type) \
+    boost::scope::detail::profile_timer boost_scope_profile_timer_ \
+        (boost::scope::profile_event_kind::kind, (action), boost::scope::detail::profile_action_name< type >())
+
+#else // defined(BOOST_SCOPE_PROFILE)
+
+#define BOOST_SCOPE_DETAIL_PROFILE_INVOCATION(kind, action, type) ((void)0)
+
+#endif // defined(BOOST_SCOPE_PROFILE)
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_DETAIL_PROFILE_HPP_INCLUDED_
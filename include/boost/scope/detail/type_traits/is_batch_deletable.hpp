@@ -0,0 +1,41 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/detail/type_traits/is_batch_deletable.hpp
+ *
+ * This header contains definition of \c is_batch_deletable type trait.
+ */
+
+#ifndef BOOST_SCOPE_DETAIL_TYPE_TRAITS_IS_BATCH_DELETABLE_HPP_INCLUDED_
+#define BOOST_SCOPE_DETAIL_TYPE_TRAITS_IS_BATCH_DELETABLE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/type_traits/is_invocable.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+namespace detail {
+
+/*
+ * Detects whether the deleter supports the optional batch protocol, i.e. is
+ * invocable as `del(res_array, count)` for a contiguous array of resources.
+ * Bulk facilities prefer this form over per-resource invocation.
+ */
+template< typename Deleter, typename Resource >
+struct is_batch_deletable : public is_invocable< Deleter&, Resource const*, std::size_t > { };
+
+} // namespace detail
+} // namespace scope
+} // namespace boost
+
+#endif // BOOST_SCOPE_DETAIL_TYPE_TRAITS_IS_BATCH_DELETABLE_HPP_INCLUDED_
@@ -0,0 +1,86 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/detail/uncaught_exception_count.hpp
+ *
+ * This header contains the \c uncaught_exception_count implementation, which
+ * avoids the out-of-line call into the EH runtime on every invocation where possible.
+ */
+
+#ifndef BOOST_SCOPE_DETAIL_UNCAUGHT_EXCEPTION_COUNT_HPP_INCLUDED_
+#define BOOST_SCOPE_DETAIL_UNCAUGHT_EXCEPTION_COUNT_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/core/uncaught_exceptions.hpp>
+
+/*
+ * On GNU-like toolchains with libstdc++, the number of uncaught exceptions is stored
+ * in a per-thread __cxa_eh_globals structure maintained by the EH runtime. Calling
+ * std::uncaught_exceptions() or boost::core::uncaught_exceptions() performs an
+ * out-of-line call into __cxa_get_globals on every invocation. Since the structure
+ * resides at a stable address for the lifetime of the thread, the address of the
+ * counter can be cached in a thread-local variable, turning subsequent queries into
+ * a plain TLS load and an integer read.
+ *
+ * The fast path is only enabled where the __cxa_eh_globals layout is known: in the
+ * Itanium C++ ABI the structure begins with a pointer to the list of caught
+ * exceptions, immediately followed by an unsigned int counter of uncaught exceptions.
+ * Define BOOST_SCOPE_NO_CACHED_UNCAUGHT_EXCEPTION_COUNT to suppress the fast path.
+ */
+#if !defined(BOOST_SCOPE_NO_CACHED_UNCAUGHT_EXCEPTION_COUNT) && !defined(BOOST_SCOPE_NO_EXCEPTIONS) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+#if defined(__GLIBCXX__) && \
+    (defined(__GNUC__) && (__GNUC__ * 100 + __GNUC_MINOR__) >= 407) && \
+    !defined(__MINGW32__) && !defined(__ibmxl__)
+#include <cxxabi.h>
+#define BOOST_SCOPE_HAS_CACHED_UNCAUGHT_EXCEPTION_COUNT
+#endif
+#endif // !defined(BOOST_SCOPE_NO_CACHED_UNCAUGHT_EXCEPTION_COUNT) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+namespace detail {
+
+#if defined(BOOST_SCOPE_HAS_CACHED_UNCAUGHT_EXCEPTION_COUNT)
+
+//! Returns a pointer to the calling thread's uncaught exception counter within the EH runtime
+inline const unsigned int* uncaught_exception_counter_address() noexcept
+{
+    return reinterpret_cast< const unsigned int* >(
+        reinterpret_cast< const unsigned char* >(::abi::__cxa_get_globals()) + sizeof(void*));
+}
+
+//! Returns the number of the currently pending exceptions
+inline unsigned int uncaught_exception_count() noexcept
+{
+    static thread_local const unsigned int* p = detail::uncaught_exception_counter_address();
+    return *p;
+}
+
+#else // defined(BOOST_SCOPE_HAS_CACHED_UNCAUGHT_EXCEPTION_COUNT)
+
+//! Returns the number of the currently pending exceptions
+inline unsigned int uncaught_exception_count() noexcept
+{
+    return boost::core::uncaught_exceptions();
+}
+
+#endif // defined(BOOST_SCOPE_HAS_CACHED_UNCAUGHT_EXCEPTION_COUNT)
+
+} // namespace detail
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_DETAIL_UNCAUGHT_EXCEPTION_COUNT_HPP_INCLUDED_
@@ -0,0 +1,67 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/errno_checker.hpp
+ *
+ * This header contains definition of \c errno_checker type.
+ */
+
+#ifndef BOOST_SCOPE_ERRNO_CHECKER_HPP_INCLUDED_
+#define BOOST_SCOPE_ERRNO_CHECKER_HPP_INCLUDED_
+
+#include <cerrno>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A predicate for checking whether `errno` indicates failure.
+ *
+ * The predicate is stateless and samples `errno` lazily, when called. A
+ * non-zero `errno` value is taken as a failure indication, and the predicate
+ * returns `true`.
+ *
+ * Since `errno` is only written by C APIs on failure, the caller must set
+ * `errno` to zero before entering the guarded scope, otherwise a stale value
+ * from an earlier failure may trigger the scope guard action.
+ *
+ * Being stateless, the predicate adds no storage to the scope guard, so a
+ * `scope_fail` guard around a syscall wrapper is no larger than the guard
+ * action itself.
+ */
+class errno_checker
+{
+public:
+    //! Predicate result type
+    typedef bool result_type;
+
+    /*!
+     * \brief Checks if `errno` indicates failure.
+     *
+     * **Throws:** Nothing.
+     *
+     * \returns `true` if `errno` is non-zero, otherwise `false`.
+     */
+    result_type operator()() const noexcept
+    {
+        return errno != 0;
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_ERRNO_CHECKER_HPP_INCLUDED_
@@ -16,7 +16,7 @@
 
 #include <boost/assert.hpp>
 #include <boost/scope/detail/config.hpp>
-#include <boost/core/uncaught_exceptions.hpp>
+#include <boost/scope/detail/uncaught_exception_count.hpp>
 #include <boost/scope/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -50,6 +50,8 @@ public:
     //! Predicate result type
     typedef bool result_type;
 
+#if !defined(BOOST_SCOPE_NO_EXCEPTIONS)
+
 private:
     unsigned int m_uncaught_count;
 
@@ -64,7 +66,7 @@ public:
      * **Throws:** Nothing.
      */
     exception_checker() noexcept :
-        m_uncaught_count(boost::core::uncaught_exceptions())
+        m_uncaught_count(detail::uncaught_exception_count())
     {
     }
 
@@ -79,13 +81,33 @@ public:
      */
     result_type operator()() const noexcept
     {
-        const unsigned int uncaught_count = boost::core::uncaught_exceptions();
+        const unsigned int uncaught_count = detail::uncaught_exception_count();
         // If this assertion fails, the predicate is likely being used in an unsupported
         // way, where it is called in a different scope or thread context from where
         // it was constructed.
         BOOST_ASSERT((uncaught_count - m_uncaught_count) <= 1u);
         return uncaught_count > m_uncaught_count;
     }
+
+#else // !defined(BOOST_SCOPE_NO_EXCEPTIONS)
+
+    /*
+     * Without exception handling support no exception can ever be in flight, so the
+     * predicate is stateless and statically returns false. This makes scope_fail
+     * guards compile to nothing and scope_success guards unconditional.
+     */
+
+public:
+    exception_checker() noexcept
+    {
+    }
+
+    result_type operator()() const noexcept
+    {
+        return false;
+    }
+
+#endif // !defined(BOOST_SCOPE_NO_EXCEPTIONS)
 };
 
 /*!
@@ -0,0 +1,86 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/fd_range.hpp
+ *
+ * This header contains definition of \c unique_fd_range type for owning
+ * a contiguous range of POSIX file descriptors. The header is empty on
+ * Windows.
+ */
+
+#ifndef BOOST_SCOPE_FD_RANGE_HPP_INCLUDED_
+#define BOOST_SCOPE_FD_RANGE_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <boost/scope/fd_deleter.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Contiguous range of POSIX file descriptors.
+ *
+ * The range is inclusive on both ends and is empty when `first > last`.
+ */
+struct fd_range
+{
+    //! First file descriptor in the range
+    int first;
+    //! Last file descriptor in the range (inclusive)
+    int last;
+};
+
+//! Contiguous file descriptor range deleter
+struct fd_range_deleter
+{
+    typedef void result_type;
+
+    //! Closes the file descriptor range with a single syscall, if possible
+    result_type operator() (fd_range const& range) const noexcept
+    {
+        detail::close_fd_range(range.first, range.last);
+    }
+};
+
+//! Contiguous file descriptor range resource traits
+struct fd_range_resource_traits
+{
+    //! Creates a default (empty) range value
+    static fd_range make_default() noexcept
+    {
+        fd_range range = { 0, -1 };
+        return range;
+    }
+
+    //! Tests if the range is allocated (non-empty)
+    static bool is_allocated(fd_range const& range) noexcept
+    {
+        return range.first >= 0 && range.first <= range.last;
+    }
+};
+
+//! Unique contiguous file descriptor range resource
+typedef unique_resource< fd_range, fd_range_deleter, fd_range_resource_traits > unique_fd_range;
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // !defined(BOOST_WINDOWS)
+
+#endif // BOOST_SCOPE_FD_RANGE_HPP_INCLUDED_
@@ -0,0 +1,209 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/fd_transfer.hpp
+ *
+ * This header contains \c send_fds and \c receive_fds functions for
+ * transferring ownership of batches of file descriptors between processes
+ * over Unix domain sockets. The header is empty on Windows.
+ */
+
+#ifndef BOOST_SCOPE_FD_TRANSFER_HPP_INCLUDED_
+#define BOOST_SCOPE_FD_TRANSFER_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <sys/socket.h>
+#include <boost/assert.hpp>
+#include <boost/scope/unique_fd.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Maximum number of file descriptors that can be transferred in one batch.
+ *
+ * This is the kernel limit on the number of descriptors in a single
+ * `SCM_RIGHTS` control message (`SCM_MAX_FD` on Linux and the BSDs).
+ */
+BOOST_CONSTEXPR_OR_CONST std::size_t max_fds_per_transfer = 253u;
+
+namespace detail {
+
+//! Control message buffer large enough for a maximum-size descriptor batch
+union fd_transfer_control_buf
+{
+    struct ::cmsghdr header;
+    unsigned char bytes[CMSG_SPACE(sizeof(int) * 253u)];
+};
+
+} // namespace detail
+
+/*!
+ * \brief Transfers ownership of a batch of file descriptors over a Unix domain socket.
+ *
+ * The descriptors held by the \a fds array are packed into a single
+ * `SCM_RIGHTS` control message and sent with one `sendmsg(2)` call,
+ * accompanied by one data byte so that stream sockets deliver the message.
+ * On success, the kernel holds references to the open file descriptions,
+ * and the local descriptors are closed — ownership has moved into the
+ * message, and there is no window where a descriptor is owned by nobody.
+ * On failure, the \a fds array is left unchanged and ownership remains
+ * with the caller.
+ *
+ * Unallocated elements of \a fds are not permitted.
+ *
+ * **Throws:** Nothing.
+ *
+ * \param socket_fd A connected Unix domain socket.
+ * \param fds Array of descriptors to transfer; emptied on success.
+ * \param count Number of descriptors, at most \c max_fds_per_transfer.
+ *
+ * \returns \c true if the batch was sent and the local descriptors were
+ *          closed, otherwise \c false with `errno` set by `sendmsg(2)`.
+ */
+inline bool send_fds(int socket_fd, unique_fd* fds, std::size_t count) noexcept
+{
+    BOOST_ASSERT(count > 0u && count <= max_fds_per_transfer);
+
+    unsigned char data = 0u;
+    struct ::iovec iov;
+    iov.iov_base = &data;
+    iov.iov_len = 1u;
+
+    detail::fd_transfer_control_buf control;
+    std::memset(&control, 0, sizeof(control));
+
+    struct ::msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1u;
+    msg.msg_control = control.bytes;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+
+    struct ::cmsghdr* const cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * count);
+
+    int* const cmsg_fds = reinterpret_cast< int* >(CMSG_DATA(cmsg));
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        BOOST_ASSERT(fds[i].allocated());
+        cmsg_fds[i] = fds[i].get();
+    }
+
+    ssize_t res;
+    do
+    {
+        res = ::sendmsg(socket_fd, &msg, 0);
+    }
+    while (BOOST_UNLIKELY(res < 0 && errno == EINTR));
+
+    if (BOOST_UNLIKELY(res < 0))
+        return false;
+
+    for (std::size_t i = 0u; i < count; ++i)
+        fds[i].reset();
+
+    return true;
+}
+
+/*!
+ * \brief Receives ownership of a batch of file descriptors from a Unix domain socket.
+ *
+ * Performs one `recvmsg(2)` call and constructs a \c unique_fd for every
+ * descriptor delivered in the `SCM_RIGHTS` control message, so the received
+ * descriptors are owned from the moment the call returns. The descriptors
+ * are received with the close-on-exec flag set where the system supports
+ * `MSG_CMSG_CLOEXEC`.
+ *
+ * If the message carries more descriptors than \a capacity, the excess
+ * descriptors are closed to prevent leaks.
+ *
+ * **Throws:** Nothing.
+ *
+ * \param socket_fd A connected Unix domain socket.
+ * \param fds Array of at least \a capacity unallocated descriptors to fill.
+ * \param capacity Maximum number of descriptors to accept.
+ *
+ * \returns The number of descriptors stored in \a fds. Zero indicates an
+ *          error or an orderly shutdown of the peer; `errno` distinguishes
+ *          the two.
+ */
+inline std::size_t receive_fds(int socket_fd, unique_fd* fds, std::size_t capacity) noexcept
+{
+    unsigned char data = 0u;
+    struct ::iovec iov;
+    iov.iov_base = &data;
+    iov.iov_len = 1u;
+
+    detail::fd_transfer_control_buf control;
+    std::memset(&control, 0, sizeof(control));
+
+    struct ::msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1u;
+    msg.msg_control = control.bytes;
+    msg.msg_controllen = sizeof(control.bytes);
+
+#if defined(MSG_CMSG_CLOEXEC)
+    const int flags = MSG_CMSG_CLOEXEC;
+#else
+    const int flags = 0;
+#endif
+
+    ssize_t res;
+    do
+    {
+        res = ::recvmsg(socket_fd, &msg, flags);
+    }
+    while (BOOST_UNLIKELY(res < 0 && errno == EINTR));
+
+    if (BOOST_UNLIKELY(res <= 0))
+        return 0u;
+
+    std::size_t received_count = 0u;
+    for (struct ::cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+            continue;
+
+        const std::size_t fd_count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const int* const cmsg_fds = reinterpret_cast< const int* >(CMSG_DATA(cmsg));
+        for (std::size_t i = 0u; i < fd_count; ++i)
+        {
+            if (BOOST_LIKELY(received_count < capacity))
+                fds[received_count++] = unique_fd(cmsg_fds[i]);
+            else
+                fd_deleter()(cmsg_fds[i]);
+        }
+    }
+
+    return received_count;
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // !defined(BOOST_WINDOWS)
+
+#endif // BOOST_SCOPE_FD_TRANSFER_HPP_INCLUDED_
@@ -0,0 +1,166 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/inplace_scope_guard_list.hpp
+ *
+ * This header contains definition of \c inplace_scope_guard_list, a
+ * fixed-capacity list of scope exit actions with inline storage.
+ */
+
+#ifndef BOOST_SCOPE_INPLACE_SCOPE_GUARD_LIST_HPP_INCLUDED_
+#define BOOST_SCOPE_INPLACE_SCOPE_GUARD_LIST_HPP_INCLUDED_
+
+#include <new>
+#include <cstddef>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Fixed-capacity list of scope exit actions with inline storage.
+ *
+ * Holds up to \a Capacity type-erased actions in aligned storage embedded in
+ * the list object itself. Nothing is ever allocated on the heap and no
+ * operation throws, which makes the list usable in allocator-forbidden and
+ * interrupt-adjacent code where \c BOOST_SCOPE_FINAL covers one fixed action
+ * but a small, runtime-determined number of actions is needed.
+ *
+ * On destruction, the actions are invoked in the reverse order of being
+ * pushed (LIFO). Like the scope guards, the list can be deactivated, in
+ * which case the actions are discarded without being invoked.
+ *
+ * Each action must fit in \a MaxActionSize bytes and be nothrow
+ * copy/move-constructible; both requirements are enforced at compile time.
+ *
+ * \tparam Capacity Maximum number of actions.
+ * \tparam MaxActionSize Size of an action slot, in bytes.
+ */
+template< std::size_t Capacity, std::size_t MaxActionSize = 4u * sizeof(void*) >
+class inplace_scope_guard_list
+{
+private:
+    struct slot
+    {
+        //! Invokes (if \c invoke is \c true) and destroys the stored action
+        void (*op)(void* storage, bool invoke);
+        typename std::aligned_storage< MaxActionSize >::type storage;
+    };
+
+private:
+    slot m_slots[Capacity];
+    std::size_t m_size;
+    bool m_active;
+
+public:
+    //! Constructs an empty active list
+    inplace_scope_guard_list() noexcept :
+        m_size(0u),
+        m_active(true)
+    {
+    }
+
+    inplace_scope_guard_list(inplace_scope_guard_list const&) = delete;
+    inplace_scope_guard_list& operator= (inplace_scope_guard_list const&) = delete;
+
+    //! If active, invokes the pushed actions in LIFO order
+    ~inplace_scope_guard_list()
+    {
+        const bool invoke = m_active;
+        for (std::size_t i = m_size; i > 0u; --i)
+        {
+            slot& s = m_slots[i - 1u];
+            s.op(static_cast< void* >(&s.storage), invoke);
+        }
+    }
+
+    /*!
+     * \brief Pushes a scope exit action, unless the list is full.
+     *
+     * \param func The action to push. Must fit in \a MaxActionSize bytes and
+     *             be nothrow copy/move-constructible.
+     *
+     * \returns \c true if the action was pushed, \c false if the list is full.
+     *
+     * **Throws:** Nothing.
+     */
+    template< typename Func >
+    bool push(Func&& func) noexcept
+    {
+        typedef typename std::decay< Func >::type func_type;
+        static_assert(sizeof(func_type) <= MaxActionSize,
+            "inplace_scope_guard_list: the action does not fit in an action slot; increase MaxActionSize");
+        static_assert(alignof(func_type) <= alignof(typename std::aligned_storage< MaxActionSize >::type),
+            "inplace_scope_guard_list: the action is over-aligned for an action slot");
+        static_assert(std::is_nothrow_constructible< func_type, Func&& >::value,
+            "inplace_scope_guard_list: the action must be nothrow copy/move-constructible");
+
+        if (BOOST_UNLIKELY(m_size >= Capacity))
+            return false;
+
+        slot& s = m_slots[m_size];
+        new (static_cast< void* >(&s.storage)) func_type(static_cast< Func&& >(func));
+        s.op = &inplace_scope_guard_list::op_impl< func_type >;
+        ++m_size;
+
+        return true;
+    }
+
+    //! Returns the number of pushed actions
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    //! Returns the maximum number of actions
+    static std::size_t capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    //! Returns \c true if no more actions can be pushed
+    bool full() const noexcept
+    {
+        return m_size >= Capacity;
+    }
+
+    //! Returns \c true if the list will invoke the actions on destruction
+    bool active() const noexcept
+    {
+        return m_active;
+    }
+
+    //! Activates or deactivates invocation of all pushed actions
+    void set_active(bool active) noexcept
+    {
+        m_active = active;
+    }
+
+private:
+    template< typename Func >
+    static void op_impl(void* storage, bool invoke)
+    {
+        Func& f = *static_cast< Func* >(storage);
+        if (invoke)
+            f();
+        f.~Func();
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_INPLACE_SCOPE_GUARD_LIST_HPP_INCLUDED_
@@ -0,0 +1,298 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/io_uring_fd_deleter.hpp
+ *
+ * This header contains definition of \c io_uring_fd_deleter, a file
+ * descriptor deleter that batches closes through a per-thread io_uring.
+ * On systems without io_uring support the deleter is equivalent to
+ * \c fd_deleter.
+ */
+
+#ifndef BOOST_SCOPE_IO_URING_FD_DELETER_HPP_INCLUDED_
+#define BOOST_SCOPE_IO_URING_FD_DELETER_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/fd_deleter.hpp>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && \
+    !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+#define BOOST_SCOPE_HAS_IO_URING_FD_DELETER
+#endif
+
+#if defined(BOOST_SCOPE_HAS_IO_URING_FD_DELETER)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstddef>
+#include <cstring>
+#endif
+
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+#if defined(BOOST_SCOPE_HAS_IO_URING_FD_DELETER)
+
+namespace detail {
+
+//! Per-thread io_uring instance used to batch IORING_OP_CLOSE submissions
+class io_uring_fd_closer
+{
+private:
+    enum : unsigned int
+    {
+        //! Number of submission queue entries requested for the ring
+        sq_entry_count = 64u,
+        //! Number of buffered submissions after which the ring is flushed to the kernel
+        submit_batch_size = 16u
+    };
+
+private:
+    int m_ring_fd;
+    void* m_ring_ptr;
+    std::size_t m_ring_mmap_size;
+    ::io_uring_sqe* m_sqes;
+    std::size_t m_sqes_mmap_size;
+    unsigned int* m_sq_tail;
+    unsigned int* m_sq_mask;
+    unsigned int* m_sq_array;
+    unsigned int* m_cq_head;
+    unsigned int* m_cq_tail;
+    unsigned int* m_cq_mask;
+    //! Number of submitted operations that have not been reaped yet
+    unsigned int m_inflight_count;
+    //! Number of queued operations that have not been submitted to the kernel yet
+    unsigned int m_pending_count;
+
+public:
+    io_uring_fd_closer() noexcept :
+        m_ring_fd(-1),
+        m_inflight_count(0u),
+        m_pending_count(0u)
+    {
+        init();
+    }
+
+    io_uring_fd_closer(io_uring_fd_closer const&) = delete;
+    io_uring_fd_closer& operator= (io_uring_fd_closer const&) = delete;
+
+    ~io_uring_fd_closer()
+    {
+        if (m_ring_fd >= 0)
+        {
+            flush();
+            ::munmap(m_sqes, m_sqes_mmap_size);
+            ::munmap(m_ring_ptr, m_ring_mmap_size);
+            ::close(m_ring_fd);
+        }
+    }
+
+    //! Tests if the ring was set up successfully
+    bool is_open() const noexcept
+    {
+        return m_ring_fd >= 0;
+    }
+
+    //! Queues an asynchronous close of the file descriptor
+    void close_fd(int fd) noexcept
+    {
+        reap();
+
+        const unsigned int mask = *m_sq_mask;
+        if (BOOST_UNLIKELY((m_inflight_count + m_pending_count) > mask))
+        {
+            // The ring is full; wait for one completion to make room
+            submit(1u);
+            reap();
+            if (BOOST_UNLIKELY((m_inflight_count + m_pending_count) > mask))
+            {
+                fd_deleter()(fd);
+                return;
+            }
+        }
+
+        const unsigned int tail = __atomic_load_n(m_sq_tail, __ATOMIC_RELAXED);
+        const unsigned int idx = tail & mask;
+        ::io_uring_sqe* sqe = m_sqes + idx;
+        std::memset(sqe, 0, sizeof(::io_uring_sqe));
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = fd;
+        m_sq_array[idx] = idx;
+        __atomic_store_n(m_sq_tail, tail + 1u, __ATOMIC_RELEASE);
+
+        ++m_pending_count;
+        if (m_pending_count >= submit_batch_size)
+            submit(0u);
+    }
+
+    //! Submits all queued operations and waits for the queued closes to complete
+    void flush() noexcept
+    {
+        if (m_inflight_count > 0u || m_pending_count > 0u)
+        {
+            submit(m_inflight_count + m_pending_count);
+            reap();
+        }
+    }
+
+private:
+    //! Sets up the io_uring instance. On failure the ring remains closed.
+    void init() noexcept
+    {
+        ::io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        int ring_fd = static_cast< int >(::syscall(__NR_io_uring_setup, sq_entry_count, &params));
+        if (ring_fd < 0)
+            return;
+
+        // Mapping the submission and completion rings separately is only needed
+        // on pre-5.4 kernels; don't bother supporting those
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0u)
+        {
+            ::close(ring_fd);
+            return;
+        }
+
+        std::size_t sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        std::size_t cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+        m_ring_mmap_size = sq_ring_size >= cq_ring_size ? sq_ring_size : cq_ring_size;
+        m_ring_ptr = ::mmap(nullptr, m_ring_mmap_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+        if (m_ring_ptr == MAP_FAILED)
+        {
+            ::close(ring_fd);
+            return;
+        }
+
+        m_sqes_mmap_size = params.sq_entries * sizeof(::io_uring_sqe);
+        m_sqes = static_cast< ::io_uring_sqe* >(::mmap(nullptr, m_sqes_mmap_size,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES));
+        if (m_sqes == MAP_FAILED)
+        {
+            ::munmap(m_ring_ptr, m_ring_mmap_size);
+            ::close(ring_fd);
+            return;
+        }
+
+        unsigned char* ring_base = static_cast< unsigned char* >(m_ring_ptr);
+        m_sq_tail = reinterpret_cast< unsigned int* >(ring_base + params.sq_off.tail);
+        m_sq_mask = reinterpret_cast< unsigned int* >(ring_base + params.sq_off.ring_mask);
+        m_sq_array = reinterpret_cast< unsigned int* >(ring_base + params.sq_off.array);
+        m_cq_head = reinterpret_cast< unsigned int* >(ring_base + params.cq_off.head);
+        m_cq_tail = reinterpret_cast< unsigned int* >(ring_base + params.cq_off.tail);
+        m_cq_mask = reinterpret_cast< unsigned int* >(ring_base + params.cq_off.ring_mask);
+
+        m_ring_fd = ring_fd;
+    }
+
+    //! Submits queued operations, waiting for \a min_complete completions
+    void submit(unsigned int min_complete) noexcept
+    {
+        int res = static_cast< int >(::syscall(__NR_io_uring_enter, m_ring_fd,
+            m_pending_count, min_complete, min_complete > 0u ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0u));
+        if (BOOST_LIKELY(res >= 0))
+        {
+            m_inflight_count += static_cast< unsigned int >(res);
+            m_pending_count -= static_cast< unsigned int >(res);
+        }
+    }
+
+    //! Consumes available completions. Close results are intentionally ignored.
+    void reap() noexcept
+    {
+        const unsigned int tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+        unsigned int head = __atomic_load_n(m_cq_head, __ATOMIC_RELAXED);
+        const unsigned int count = tail - head;
+        if (count > 0u)
+        {
+            __atomic_store_n(m_cq_head, tail, __ATOMIC_RELEASE);
+            m_inflight_count -= count;
+        }
+    }
+};
+
+//! Returns the calling thread's io_uring closer instance
+inline io_uring_fd_closer& get_io_uring_fd_closer() noexcept
+{
+    static thread_local io_uring_fd_closer closer;
+    return closer;
+}
+
+} // namespace detail
+
+/*!
+ * \brief File descriptor deleter that batches closes through a per-thread io_uring.
+ *
+ * Instead of a synchronous `close(2)` per descriptor, the deleter queues an
+ * \c IORING_OP_CLOSE submission in a lazily created per-thread ring and flushes
+ * submissions to the kernel in batches, amortizing descriptor release to a
+ * fraction of a syscall each. Completions are reaped opportunistically and any
+ * outstanding closes are completed when the thread exits or when \c flush() is
+ * called. Close errors are ignored, same as in \c fd_deleter.
+ *
+ * If the ring cannot be set up (io_uring unavailable or prohibited), the
+ * deleter falls back to \c fd_deleter behavior.
+ */
+struct io_uring_fd_deleter
+{
+    typedef void result_type;
+
+    //! Queues closing of the file descriptor
+    result_type operator() (int fd) const noexcept
+    {
+        detail::io_uring_fd_closer& closer = detail::get_io_uring_fd_closer();
+        if (BOOST_LIKELY(closer.is_open()))
+            closer.close_fd(fd);
+        else
+            fd_deleter()(fd);
+    }
+
+    /*!
+     * \brief Submits the calling thread's queued closes and waits for them to complete.
+     *
+     * After this call returns, every descriptor previously passed to the deleter
+     * on this thread has been closed.
+     */
+    static void flush() noexcept
+    {
+        detail::io_uring_fd_closer& closer = detail::get_io_uring_fd_closer();
+        if (closer.is_open())
+            closer.flush();
+    }
+};
+
+#else // defined(BOOST_SCOPE_HAS_IO_URING_FD_DELETER)
+
+//! On systems without io_uring the deleter closes descriptors synchronously
+struct io_uring_fd_deleter :
+    public fd_deleter
+{
+    //! No queued closes to wait for
+    static void flush() noexcept
+    {
+    }
+};
+
+#endif // defined(BOOST_SCOPE_HAS_IO_URING_FD_DELETER)
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_IO_URING_FD_DELETER_HPP_INCLUDED_
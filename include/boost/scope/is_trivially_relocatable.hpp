@@ -0,0 +1,81 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/is_trivially_relocatable.hpp
+ *
+ * This header contains definition of \c is_trivially_relocatable trait.
+ */
+
+#ifndef BOOST_SCOPE_IS_TRIVIALLY_RELOCATABLE_HPP_INCLUDED_
+#define BOOST_SCOPE_IS_TRIVIALLY_RELOCATABLE_HPP_INCLUDED_
+
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/unique_resource_fwd.hpp>
+#include <boost/scope/detail/type_traits/conjunction.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Indicates whether objects of type \a T can be relocated by copying
+ *        the object representation and not destroying the source.
+ *
+ * A type is trivially relocatable when the combination of move-constructing
+ * a new object from an object of type \a T and destroying the source is
+ * equivalent to copying the source object's bytes to the new location.
+ * Containers may use this property to reallocate storage with `memcpy`-like
+ * operations instead of element-wise move construction and destruction.
+ *
+ * By default, the trait is equivalent to `std::is_trivially_copyable`. Users
+ * may specialize the trait for their own types. The library specializes the
+ * trait for \c unique_resource.
+ *
+ * \note The standard does not currently define trivial relocation, so this
+ *       trait is advisory: standard containers will not pick it up
+ *       automatically, but custom containers and allocators can.
+ *
+ * \tparam T Type to test for trivial relocatability.
+ */
+template< typename T >
+struct is_trivially_relocatable :
+    public std::is_trivially_copyable< T >::type
+{
+};
+
+/*!
+ * \brief Specialization of \c is_trivially_relocatable for \c unique_resource.
+ *
+ * A \c unique_resource specialization is trivially relocatable when both the
+ * resource and the deleter are trivially copyable, which in particular holds
+ * for \c unique_fd (`int` resource, stateless deleter, flag-free
+ * \c fd_resource_traits storage). Moving such a \c unique_resource merely
+ * copies the resource and deleter and deactivates the source, and destroying
+ * a deactivated \c unique_resource has no effect, which together are
+ * equivalent to copying the object representation.
+ */
+template< typename Resource, typename Deleter, typename Traits >
+struct is_trivially_relocatable< unique_resource< Resource, Deleter, Traits > > :
+    public detail::conjunction<
+        std::is_trivially_copyable< Resource >,
+        std::is_trivially_copyable< Deleter >
+    >::type
+{
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_IS_TRIVIALLY_RELOCATABLE_HPP_INCLUDED_
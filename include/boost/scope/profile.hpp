@@ -0,0 +1,95 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/profile.hpp
+ *
+ * This header contains the API for draining \c BOOST_SCOPE_PROFILE
+ * instrumentation buffers. When the macro is not defined, the drain
+ * functions are no-op stubs, so consumer code compiles in both modes.
+ */
+
+#ifndef BOOST_SCOPE_PROFILE_HPP_INCLUDED_
+#define BOOST_SCOPE_PROFILE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstdint>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/profile.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+#if defined(BOOST_SCOPE_PROFILE)
+
+/*!
+ * \brief Drains the profile event buffers of all threads.
+ *
+ * Invokes \a visitor with a `profile_event const&` argument for every
+ * recorded event and removes the events from the buffers. Events of one
+ * thread are visited in recording order; events of different threads are
+ * not interleaved in timestamp order.
+ *
+ * Draining may run concurrently with threads recording new events, but
+ * concurrent calls to this function are not supported.
+ *
+ * \returns The number of events visited.
+ */
+template< typename Visitor >
+inline std::size_t drain_profile_events(Visitor&& visitor)
+{
+    std::size_t count = 0u;
+    for (detail::profile_ring* ring = detail::profile_ring::list_head(); ring != nullptr; ring = ring->next())
+    {
+        count += ring->drain(visitor);
+    }
+
+    return count;
+}
+
+/*!
+ * \brief Returns the total number of events dropped due to buffer overflow.
+ *
+ * **Throws:** Nothing.
+ */
+inline std::uint64_t profile_events_dropped() noexcept
+{
+    std::uint64_t count = 0u;
+    for (detail::profile_ring* ring = detail::profile_ring::list_head(); ring != nullptr; ring = ring->next())
+    {
+        count += ring->dropped();
+    }
+
+    return count;
+}
+
+#else // defined(BOOST_SCOPE_PROFILE)
+
+template< typename Visitor >
+inline std::size_t drain_profile_events(Visitor&&) noexcept
+{
+    return 0u;
+}
+
+inline std::uint64_t profile_events_dropped() noexcept
+{
+    return 0u;
+}
+
+#endif // defined(BOOST_SCOPE_PROFILE)
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_PROFILE_HPP_INCLUDED_
@@ -0,0 +1,109 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/result_checker.hpp
+ *
+ * This header contains definition of \c result_checker type.
+ */
+
+#ifndef BOOST_SCOPE_RESULT_CHECKER_HPP_INCLUDED_
+#define BOOST_SCOPE_RESULT_CHECKER_HPP_INCLUDED_
+
+#include <boost/core/addressof.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A predicate for checking whether a result object holds an error.
+ *
+ * The predicate captures a reference to an external result object, which it
+ * tests for a contained value when called. The result object must remain
+ * valid for the whole lifetime duration of the predicate.
+ *
+ * For a result object `res`, an expression `res.has_value()` must be valid,
+ * never throw exceptions, and return a value contextually convertible to
+ * `bool`. If the returned value converts to `false`, then this is taken as
+ * an error indication, and the predicate returns `true`. Otherwise, the
+ * predicate returns `false`.
+ *
+ * A few examples of result types:
+ *
+ * \li `std::expected` or `boost::system::result`,
+ * \li `boost::outcome_v2::basic_outcome` or `boost::outcome_v2::basic_result`,
+ * \li `std::optional` or `boost::optional`.
+ *
+ * The predicate is intended as a condition function object for \c scope_fail
+ * and \c scope_success in code that reports failures through result objects
+ * rather than exceptions. Unlike the default \c exception_checker, it does
+ * not interact with the exception runtime, which makes the guards usable in
+ * exception-free code and avoids the cost of querying the count of uncaught
+ * exceptions.
+ *
+ * \tparam Result Result object type.
+ */
+template< typename Result >
+class result_checker
+{
+public:
+    //! Predicate result type
+    typedef bool result_type;
+
+private:
+    Result* m_result;
+
+public:
+    /*!
+     * \brief Constructs the predicate.
+     *
+     * Upon construction, the predicate saves a reference to the external result object.
+     * The referenced object must remain valid for the whole lifetime duration of the predicate.
+     *
+     * **Throws:** Nothing.
+     */
+    explicit result_checker(Result& res) noexcept :
+        m_result(boost::addressof(res))
+    {
+    }
+
+    /*!
+     * \brief Checks if the result object holds an error.
+     *
+     * **Throws:** Nothing.
+     *
+     * \returns As if `!res.has_value()`, where `res` is the result object passed to the predicate constructor.
+     */
+    result_type operator()() const noexcept
+    {
+        return !m_result->has_value();
+    }
+};
+
+/*!
+ * \brief Creates a predicate for checking whether a result object holds an error
+ *
+ * **Throws:** Nothing.
+ */
+template< typename Result >
+inline result_checker< Result > check_result(Result& res) noexcept
+{
+    return result_checker< Result >(res);
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_RESULT_CHECKER_HPP_INCLUDED_
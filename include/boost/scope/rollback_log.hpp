@@ -0,0 +1,138 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/rollback_log.hpp
+ *
+ * This header contains definition of \c rollback_log, a transaction undo
+ * log with \c scope_fail semantics.
+ */
+
+#ifndef BOOST_SCOPE_ROLLBACK_LOG_HPP_INCLUDED_
+#define BOOST_SCOPE_ROLLBACK_LOG_HPP_INCLUDED_
+
+#include <cstddef>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/exception_checker.hpp>
+#include <boost/scope/scope_guard_stack.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Transaction undo log that replays recorded actions in reverse on failure.
+ *
+ * Each step of a multi-step mutation pushes an undo action into the log. If
+ * the transaction fails — by default, if an exception is thrown before the
+ * log is destroyed, same as \c scope_fail — the undo actions are replayed in
+ * the reverse order of being pushed. Calling \c commit() marks the
+ * transaction as successful, after which the undo actions are discarded
+ * without being invoked.
+ *
+ * Compared to one \c scope_fail guard per step, the undo records are stored
+ * contiguously in a bump-pointer arena and the failure condition is
+ * evaluated once, when the log is destroyed, instead of once per guard.
+ *
+ * \tparam FailureCondition The failure condition function object type. The
+ *         default checks for an exception being thrown, as in \c scope_fail.
+ */
+template< typename FailureCondition = exception_checker >
+class basic_rollback_log
+{
+private:
+    scope_guard_stack m_undo_actions;
+    FailureCondition m_failure_condition;
+    bool m_committed;
+
+public:
+    /*!
+     * \brief Constructs an empty log and captures the initial failure
+     *        condition state.
+     *
+     * \param initial_chunk_size Size of the first undo arena chunk, in bytes.
+     */
+    explicit basic_rollback_log(std::size_t initial_chunk_size = 256u) noexcept(std::is_nothrow_default_constructible< FailureCondition >::value) :
+        m_undo_actions(initial_chunk_size),
+        m_committed(false)
+    {
+    }
+
+    /*!
+     * \brief Constructs an empty log with the given failure condition.
+     *
+     * \param failure_condition The failure condition function object.
+     * \param initial_chunk_size Size of the first undo arena chunk, in bytes.
+     */
+    explicit basic_rollback_log(FailureCondition const& failure_condition, std::size_t initial_chunk_size = 256u) noexcept(std::is_nothrow_copy_constructible< FailureCondition >::value) :
+        m_undo_actions(initial_chunk_size),
+        m_failure_condition(failure_condition),
+        m_committed(false)
+    {
+    }
+
+    basic_rollback_log(basic_rollback_log const&) = delete;
+    basic_rollback_log& operator= (basic_rollback_log const&) = delete;
+
+    /*!
+     * \brief If the log is not committed, evaluates the failure condition once
+     *        and, if it returns \c true, replays the undo actions in reverse.
+     */
+    ~basic_rollback_log()
+    {
+        m_undo_actions.set_active(!m_committed && m_failure_condition());
+    }
+
+    /*!
+     * \brief Pushes an undo action for the step being performed.
+     *
+     * If pushing fails, the previously pushed undo actions remain recorded.
+     *
+     * **Throws:** \c std::bad_alloc if a new arena chunk cannot be allocated,
+     *             and any exception thrown by the copy/move constructor of the action.
+     */
+    template< typename Func >
+    void push(Func&& func)
+    {
+        m_undo_actions.push(static_cast< Func&& >(func));
+    }
+
+    /*!
+     * \brief Marks the transaction as successful.
+     *
+     * After this call, the undo actions will not be invoked, regardless of
+     * the failure condition. Further undo actions can still be pushed; they
+     * belong to the same committed transaction and are discarded as well.
+     *
+     * **Throws:** Nothing.
+     */
+    void commit() noexcept
+    {
+        m_committed = true;
+    }
+
+    //! Returns \c true if the transaction was committed
+    bool committed() const noexcept
+    {
+        return m_committed;
+    }
+};
+
+//! Transaction undo log that rolls back when an exception is thrown
+typedef basic_rollback_log<> rollback_log;
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_ROLLBACK_LOG_HPP_INCLUDED_
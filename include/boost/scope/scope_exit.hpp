@@ -14,10 +14,12 @@
 #ifndef BOOST_SCOPE_SCOPE_EXIT_HPP_INCLUDED_
 #define BOOST_SCOPE_SCOPE_EXIT_HPP_INCLUDED_
 
+#include <cstdint>
 #include <type_traits>
 #include <boost/scope/detail/config.hpp>
 #include <boost/scope/detail/is_not_like.hpp>
 #include <boost/scope/detail/compact_storage.hpp>
+#include <boost/scope/detail/profile.hpp>
 #include <boost/scope/detail/move_or_copy_construct_ref.hpp>
 #include <boost/scope/detail/type_traits/conjunction.hpp>
 #include <boost/scope/detail/type_traits/is_invocable.hpp>
@@ -50,7 +52,7 @@ private:
     bool m_active;
 
 public:
-    init_guard(Func& func, Cond& cond, bool active) noexcept :
+    BOOST_SCOPE_CXX20_CONSTEXPR init_guard(Func& func, Cond& cond, bool active) noexcept :
         m_func(func),
         m_cond(cond),
         m_active(active)
@@ -60,30 +62,38 @@ public:
     init_guard(init_guard const&) = delete;
     init_guard& operator= (init_guard const&) = delete;
 
-    ~init_guard()
+    BOOST_SCOPE_CXX20_CONSTEXPR ~init_guard()
         noexcept(detail::conjunction<
             detail::is_nothrow_invocable< Func& >,
             detail::is_nothrow_invocable< Cond& >
         >::value)
     {
         if (m_active && m_cond())
-            m_func();
+            invoke_action();
     }
 
-    Func&& get_func() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR Func&& get_func() noexcept
     {
         return static_cast< Func&& >(m_func);
     }
 
-    Cond&& get_cond() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR Cond&& get_cond() noexcept
     {
         return static_cast< Cond&& >(m_cond);
     }
 
-    void deactivate() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void deactivate() noexcept
     {
         m_active = false;
     }
+
+private:
+    //! Invokes the action; only reached when the scope guard construction throws
+    BOOST_SCOPE_COLD BOOST_SCOPE_CXX20_CONSTEXPR void invoke_action()
+        noexcept(detail::is_nothrow_invocable< Func& >::value)
+    {
+        m_func();
+    }
 };
 
 } // namespace detail
@@ -105,7 +115,7 @@ public:
      *
      * \returns \c true.
      */
-    result_type operator()() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR result_type operator()() const noexcept
     {
         return true;
     }
@@ -159,7 +169,7 @@ private:
             typename C,
             typename = typename std::enable_if< std::is_constructible< Func, F >::value >::type
         >
-        explicit func_holder(F&& func, C&& cond, bool active, std::true_type) noexcept :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit func_holder(F&& func, C&& cond, bool active, std::true_type) noexcept :
             func_base(static_cast< F&& >(func))
         {
         }
@@ -169,14 +179,14 @@ private:
             typename C,
             typename = typename std::enable_if< std::is_constructible< Func, F >::value >::type
         >
-        explicit func_holder(F&& func, C&& cond, bool active, std::false_type) :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit func_holder(F&& func, C&& cond, bool active, std::false_type) :
             func_holder(detail::init_guard< F, C >(func, cond, active))
         {
         }
 
     private:
         template< typename F, typename C >
-        explicit func_holder(detail::init_guard< F, C >&& init) :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit func_holder(detail::init_guard< F, C >&& init) :
             func_base(init.get_func())
         {
             init.deactivate();
@@ -192,7 +202,7 @@ private:
             typename C,
             typename = typename std::enable_if< std::is_constructible< Cond, C >::value >::type
         >
-        explicit cond_holder(C&& cond, Func& func, bool active, std::true_type) noexcept :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit cond_holder(C&& cond, Func& func, bool active, std::true_type) noexcept :
             cond_base(static_cast< C&& >(cond))
         {
         }
@@ -201,14 +211,14 @@ private:
             typename C,
             typename = typename std::enable_if< std::is_constructible< Cond, C >::value >::type
         >
-        explicit cond_holder(C&& cond, Func& func, bool active, std::false_type) :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit cond_holder(C&& cond, Func& func, bool active, std::false_type) :
             cond_holder(detail::init_guard< Func&, C >(func, cond, active))
         {
         }
 
     private:
         template< typename C >
-        explicit cond_holder(detail::init_guard< Func&, C >&& init) :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit cond_holder(detail::init_guard< Func&, C >&& init) :
             cond_base(init.get_cond())
         {
             init.deactivate();
@@ -229,7 +239,7 @@ private:
                 std::is_constructible< cond_holder, C, Func&, bool, typename std::is_nothrow_constructible< Cond, C >::type >
             >::value >::type
         >
-        explicit data(F&& func, C&& cond, bool active)
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit data(F&& func, C&& cond, bool active)
             noexcept(detail::conjunction< std::is_nothrow_constructible< Func, F >, std::is_nothrow_constructible< Cond, C > >::value) :
             func_holder(static_cast< F&& >(func), static_cast< C&& >(cond), active, typename std::is_nothrow_constructible< Func, F >::type()),
             cond_holder(static_cast< C&& >(cond), func_holder::get(), active, typename std::is_nothrow_constructible< Cond, C >::type()),
@@ -237,27 +247,27 @@ private:
         {
         }
 
-        Func& get_func() noexcept
+        BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR Func& get_func() noexcept
         {
             return func_holder::get();
         }
 
-        Func const& get_func() const noexcept
+        BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR Func const& get_func() const noexcept
         {
             return func_holder::get();
         }
 
-        Cond& get_cond() noexcept
+        BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR Cond& get_cond() noexcept
         {
             return cond_holder::get();
         }
 
-        Cond const& get_cond() const noexcept
+        BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR Cond const& get_cond() const noexcept
         {
             return cond_holder::get();
         }
 
-        bool deactivate() noexcept
+        BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR bool deactivate() noexcept
         {
             bool active = m_active;
             m_active = false;
@@ -267,6 +277,16 @@ private:
 
     data m_data;
 
+    //! Invokes the wrapped action function object; kept out of line so that
+    //! the inline destructor fast path is a flag check and a branch
+    BOOST_SCOPE_COLD BOOST_SCOPE_CXX20_CONSTEXPR void invoke_action()
+        noexcept(detail::is_nothrow_invocable< Func& >::value)
+    {
+        BOOST_SCOPE_DETAIL_PROFILE_INVOCATION(scope_exit_action,
+            boost::scope::detail::profile_action_address(m_data.get_func()), Func);
+        m_data.get_func()();
+    }
+
 //! \endcond
 public:
     /*!
@@ -303,7 +323,7 @@ public:
         >::value >::type
         //! \endcond
     >
-    explicit scope_exit(F&& func, bool active = true)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit scope_exit(F&& func, bool active = true)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -357,7 +377,7 @@ public:
         >::value >::type
         //! \endcond
     >
-    explicit scope_exit(F&& func, C&& cond, bool active = true)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit scope_exit(F&& func, C&& cond, bool active = true)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -409,7 +429,7 @@ public:
         typename = typename std::enable_if< Requires >::type
     >
     //! \endcond
-    scope_exit(scope_exit&& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR scope_exit(scope_exit&& that)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -438,7 +458,7 @@ public:
      *
      * **Throws:** Nothing, unless invoking a function object throws.
      */
-    ~scope_exit()
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR ~scope_exit()
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             detail::conjunction<
                 detail::is_nothrow_invocable< Func& >,
@@ -446,8 +466,8 @@ public:
             >::value
         ))
     {
-        if (BOOST_LIKELY(m_data.m_active && m_data.get_cond()()))
-            m_data.get_func()();
+        if (m_data.m_active && m_data.get_cond()())
+            invoke_action();
     }
 
     /*!
@@ -457,7 +477,7 @@ public:
      *
      * **Throws:** Nothing.
      */
-    bool active() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR bool active() const noexcept
     {
         return m_data.m_active;
     }
@@ -471,7 +491,7 @@ public:
      *
      * \post `this->active() == active`
      */
-    void set_active(bool active) noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void set_active(bool active) noexcept
     {
         m_data.m_active = active;
     }
@@ -485,12 +505,132 @@ public:
      *
      * \post `this->active() == false`
      */
-    void release() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void release() noexcept
     {
         m_data.m_active = false;
     }
 };
 
+#if defined(BOOST_SCOPE_HAS_TAGGED_FUNCTION_POINTERS)
+
+//! \cond
+namespace detail {
+
+/*!
+ * \brief Scope guard implementation for function pointers that encodes
+ *        the inactive state in bit 0 of the pointer.
+ *
+ * On the supported architectures functions are aligned to at least 2 bytes,
+ * so bit 0 of a function pointer is always clear. Setting it marks the guard
+ * inactive while preserving the pointer value, which keeps the `set_active`
+ * API functional and collapses the guard to a single machine word.
+ */
+template< typename FuncPtr >
+class tagged_func_ptr_scope_exit
+{
+private:
+    static_assert(sizeof(FuncPtr) == sizeof(std::uintptr_t), "Unexpected function pointer size");
+
+    static BOOST_CONSTEXPR_OR_CONST std::uintptr_t inactive_bit = 1u;
+
+    std::uintptr_t m_func;
+
+public:
+    explicit tagged_func_ptr_scope_exit(FuncPtr func, bool active = true) noexcept :
+        m_func(reinterpret_cast< std::uintptr_t >(func) | static_cast< std::uintptr_t >(!active))
+    {
+    }
+
+    explicit tagged_func_ptr_scope_exit(FuncPtr func, always_true, bool active = true) noexcept :
+        m_func(reinterpret_cast< std::uintptr_t >(func) | static_cast< std::uintptr_t >(!active))
+    {
+    }
+
+    tagged_func_ptr_scope_exit(tagged_func_ptr_scope_exit&& that) noexcept :
+        m_func(that.m_func)
+    {
+        that.m_func |= inactive_bit;
+    }
+
+    tagged_func_ptr_scope_exit& operator= (tagged_func_ptr_scope_exit&&) = delete;
+
+    tagged_func_ptr_scope_exit(tagged_func_ptr_scope_exit const&) = delete;
+    tagged_func_ptr_scope_exit& operator= (tagged_func_ptr_scope_exit const&) = delete;
+
+    BOOST_SCOPE_FORCEINLINE ~tagged_func_ptr_scope_exit() noexcept(detail::is_nothrow_invocable< FuncPtr& >::value)
+    {
+        if (BOOST_LIKELY((m_func & inactive_bit) == 0u))
+        {
+            BOOST_SCOPE_DETAIL_PROFILE_INVOCATION(scope_exit_action,
+                reinterpret_cast< const void* >(m_func), FuncPtr);
+            reinterpret_cast< FuncPtr >(m_func)();
+        }
+    }
+
+    BOOST_SCOPE_FORCEINLINE bool active() const noexcept
+    {
+        return (m_func & inactive_bit) == 0u;
+    }
+
+    BOOST_SCOPE_FORCEINLINE void set_active(bool active) noexcept
+    {
+        if (active)
+            m_func &= ~inactive_bit;
+        else
+            m_func |= inactive_bit;
+    }
+
+    BOOST_SCOPE_FORCEINLINE void release() noexcept
+    {
+        m_func |= inactive_bit;
+    }
+};
+
+} // namespace detail
+//! \endcond
+
+/*!
+ * \brief Specialization of \c scope_exit for function pointers with the default
+ *        condition, stored in a single machine word.
+ *
+ * The active flag is encoded in bit 0 of the function pointer, so the guard
+ * occupies `sizeof(void (*)())` bytes instead of a pointer plus a separate
+ * flag. The public interface is identical to the primary template.
+ */
+template< typename R >
+class scope_exit< R (*)(), always_true > :
+    public detail::tagged_func_ptr_scope_exit< R (*)() >
+{
+//! \cond
+private:
+    typedef detail::tagged_func_ptr_scope_exit< R (*)() > base_type;
+
+public:
+    using base_type::base_type;
+//! \endcond
+};
+
+#if defined(__cpp_noexcept_function_type)
+/*!
+ * \brief Specialization of \c scope_exit for `noexcept` function pointers with
+ *        the default condition, stored in a single machine word.
+ */
+template< typename R >
+class scope_exit< R (*)() noexcept, always_true > :
+    public detail::tagged_func_ptr_scope_exit< R (*)() noexcept >
+{
+//! \cond
+private:
+    typedef detail::tagged_func_ptr_scope_exit< R (*)() noexcept > base_type;
+
+public:
+    using base_type::base_type;
+//! \endcond
+};
+#endif // defined(__cpp_noexcept_function_type)
+
+#endif // defined(BOOST_SCOPE_HAS_TAGGED_FUNCTION_POINTERS)
+
 #if !defined(BOOST_NO_CXX17_DEDUCTION_GUIDES)
 template< typename Func >
 scope_exit(Func) -> scope_exit< Func >;
@@ -520,7 +660,7 @@ scope_exit(scope_exit< Func, Cond >&&) -> scope_exit< Func, Cond >;
  * \param active Indicates whether the scope guard should be active upon construction.
  */
 template< typename F >
-inline scope_exit<
+inline BOOST_SCOPE_CXX20_CONSTEXPR scope_exit<
     typename std::remove_cv< typename std::remove_reference< F >::type >::type
 > make_scope_exit(F&& func, bool active = true)
     noexcept(std::is_nothrow_constructible<
@@ -549,7 +689,7 @@ inline scope_exit<
  * \param active Indicates whether the scope guard should be active upon construction.
  */
 template< typename F, typename C >
-inline typename std::enable_if<
+inline BOOST_SCOPE_CXX20_CONSTEXPR typename std::enable_if<
     std::is_constructible<
         scope_exit<
             typename std::remove_cv< typename std::remove_reference< F >::type >::type,
@@ -0,0 +1,123 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/scope_exit_ref.hpp
+ *
+ * This header contains definition of \c scope_exit_ref, a non-owning
+ * scope guard referencing an externally stored action.
+ */
+
+#ifndef BOOST_SCOPE_SCOPE_EXIT_REF_HPP_INCLUDED_
+#define BOOST_SCOPE_SCOPE_EXIT_REF_HPP_INCLUDED_
+
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Non-owning scope guard that references an externally stored action.
+ *
+ * Unlike \c scope_exit, which copies or moves the action into the guard,
+ * \c scope_exit_ref only stores a pointer to the action object and a thunk
+ * that invokes it, in the spirit of `function_ref`. This avoids constructing
+ * a copy of large captured state when the state outlives the scope anyway,
+ * and gives the guard a fixed two-pointer layout (plus the activity flag)
+ * that is usable across ABI-stable plugin interfaces.
+ *
+ * The referenced action must outlive the guard; the guard can only be
+ * constructed from an lvalue to make accidental binding to a temporary a
+ * compile-time error. The activation interface matches \c scope_exit:
+ * the action is invoked on destruction if the guard is active, and moving
+ * from a guard deactivates the source.
+ */
+class scope_exit_ref
+{
+private:
+    void* m_func;
+    void (*m_thunk)(void*);
+    bool m_active;
+
+public:
+    /*!
+     * \brief Constructs the guard referencing \a func.
+     *
+     * \param func The scope exit action. The object must outlive the guard.
+     * \param active Indicates whether the guard should be active upon construction.
+     *
+     * **Throws:** Nothing.
+     */
+    template<
+        typename Func,
+        typename = typename std::enable_if<
+            !std::is_same< typename std::remove_cv< Func >::type, scope_exit_ref >::value
+        >::type
+    >
+    explicit scope_exit_ref(Func& func, bool active = true) noexcept :
+        m_func(const_cast< typename std::remove_cv< Func >::type* >(&func)),
+        m_thunk(&scope_exit_ref::thunk< Func >),
+        m_active(active)
+    {
+    }
+
+    //! Binding the guard to a temporary action is not allowed
+    template< typename Func >
+    explicit scope_exit_ref(Func const&& func, bool active = true) = delete;
+
+    //! Moves the action reference from \a that and deactivates \a that
+    scope_exit_ref(scope_exit_ref&& that) noexcept :
+        m_func(that.m_func),
+        m_thunk(that.m_thunk),
+        m_active(that.m_active)
+    {
+        that.m_active = false;
+    }
+
+    scope_exit_ref(scope_exit_ref const&) = delete;
+    scope_exit_ref& operator= (scope_exit_ref&&) = delete;
+    scope_exit_ref& operator= (scope_exit_ref const&) = delete;
+
+    //! If active, invokes the referenced action
+    ~scope_exit_ref()
+    {
+        if (BOOST_LIKELY(m_active))
+            m_thunk(m_func);
+    }
+
+    //! Returns \c true if the scope guard is active, otherwise \c false
+    bool active() const noexcept
+    {
+        return m_active;
+    }
+
+    //! Activates or deactivates the scope guard
+    void set_active(bool active) noexcept
+    {
+        m_active = active;
+    }
+
+private:
+    template< typename Func >
+    static void thunk(void* func)
+    {
+        (*static_cast< Func* >(func))();
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_SCOPE_EXIT_REF_HPP_INCLUDED_
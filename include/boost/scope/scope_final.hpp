@@ -18,6 +18,7 @@
 #include <boost/scope/detail/config.hpp>
 #include <boost/scope/detail/is_not_like.hpp>
 #include <boost/scope/detail/move_or_copy_construct_ref.hpp>
+#include <boost/scope/detail/profile.hpp>
 #include <boost/scope/detail/type_traits/conjunction.hpp>
 #include <boost/scope/detail/type_traits/is_nothrow_invocable.hpp>
 #include <boost/scope/detail/header.hpp>
@@ -63,13 +64,13 @@ private:
         Func m_func;
 
         template< typename F, typename = typename std::enable_if< std::is_constructible< Func, F >::value >::type >
-        explicit data(F&& func, std::true_type) noexcept :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit data(F&& func, std::true_type) noexcept :
             m_func(static_cast< F&& >(func))
         {
         }
 
         template< typename F, typename = typename std::enable_if< std::is_constructible< Func, F >::value >::type >
-        explicit data(F&& func, std::false_type) try :
+        BOOST_SCOPE_CXX20_CONSTEXPR explicit data(F&& func, std::false_type) try :
             m_func(static_cast< F&& >(func))
         {
         }
@@ -110,7 +111,7 @@ public:
         >::value >::type
         //! \endcond
     >
-    scope_final(F&& func)
+    BOOST_SCOPE_CXX20_CONSTEXPR scope_final(F&& func)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -134,8 +135,10 @@ public:
      *
      * **Throws:** Nothing, unless invoking the callable throws.
      */
-    ~scope_final() noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(detail::is_nothrow_invocable< Func& >::value))
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR ~scope_final() noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(detail::is_nothrow_invocable< Func& >::value))
     {
+        BOOST_SCOPE_DETAIL_PROFILE_INVOCATION(scope_final_action,
+            boost::scope::detail::profile_action_address(m_data.m_func), Func);
         m_data.m_func();
     }
 };
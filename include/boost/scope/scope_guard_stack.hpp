@@ -0,0 +1,224 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/scope_guard_stack.hpp
+ *
+ * This header contains definition of \c scope_guard_stack, a dynamic list
+ * of scope exit actions backed by a bump-pointer arena.
+ */
+
+#ifndef BOOST_SCOPE_SCOPE_GUARD_STACK_HPP_INCLUDED_
+#define BOOST_SCOPE_SCOPE_GUARD_STACK_HPP_INCLUDED_
+
+#include <new>
+#include <cstddef>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Dynamic list of scope exit actions with arena-backed storage.
+ *
+ * Unlike \c scope_exit, which holds exactly one statically-typed action,
+ * \c scope_guard_stack records an arbitrary number of actions discovered at
+ * runtime. The actions are stored back to back in bump-pointer arena chunks,
+ * so pushing an action costs a pointer bump in the common case and a single
+ * chunk allocation when the arena grows; there is no per-action heap traffic.
+ *
+ * On destruction, the actions are invoked in the reverse order of being
+ * pushed (LIFO), matching the semantics of a stack of individual scope
+ * guards. Like the scope guards, the stack can be deactivated, in which
+ * case the actions are discarded without being invoked.
+ *
+ * If an action throws an exception, the remaining actions are not invoked
+ * and \c std::terminate is called, since the exception is thrown while
+ * unwinding the stack object.
+ */
+class scope_guard_stack
+{
+private:
+    struct node_header
+    {
+        //! Previously pushed node, in LIFO order
+        node_header* prev;
+        //! Invokes (if \c invoke is \c true) and destroys the stored action
+        void (*op)(node_header* self, bool invoke);
+    };
+
+    template< typename Func >
+    struct node :
+        public node_header
+    {
+        Func func;
+
+        template< typename F >
+        explicit node(node_header* prev, F&& f) :
+            func(static_cast< F&& >(f))
+        {
+            this->prev = prev;
+            this->op = &node::do_op;
+        }
+
+        static void do_op(node_header* self, bool invoke)
+        {
+            Func& f = static_cast< node* >(self)->func;
+            if (invoke)
+                f();
+            f.~Func();
+        }
+    };
+
+    struct chunk_header
+    {
+        //! Previously allocated chunk
+        chunk_header* prev;
+        //! Chunk size, including this header
+        std::size_t size;
+    };
+
+private:
+    node_header* m_last_node;
+    chunk_header* m_current_chunk;
+    //! Current allocation position in the current chunk
+    unsigned char* m_pos;
+    //! End of the current chunk
+    unsigned char* m_end;
+    std::size_t m_initial_chunk_size;
+    bool m_active;
+
+public:
+    /*!
+     * \brief Constructs an empty active stack. No memory is allocated until
+     *        the first action is pushed.
+     *
+     * \param initial_chunk_size Size of the first arena chunk, in bytes.
+     */
+    explicit scope_guard_stack(std::size_t initial_chunk_size = 256u) noexcept :
+        m_last_node(nullptr),
+        m_current_chunk(nullptr),
+        m_pos(nullptr),
+        m_end(nullptr),
+        m_initial_chunk_size(initial_chunk_size),
+        m_active(true)
+    {
+    }
+
+    scope_guard_stack(scope_guard_stack const&) = delete;
+    scope_guard_stack& operator= (scope_guard_stack const&) = delete;
+
+    //! If active, invokes the pushed actions in LIFO order, then frees the arena
+    ~scope_guard_stack()
+    {
+        node_header* p = m_last_node;
+        const bool invoke = m_active;
+        while (p != nullptr)
+        {
+            node_header* const prev = p->prev;
+            p->op(p, invoke);
+            p = prev;
+        }
+
+        chunk_header* chunk = m_current_chunk;
+        while (chunk != nullptr)
+        {
+            chunk_header* const prev = chunk->prev;
+            ::operator delete(static_cast< void* >(chunk));
+            chunk = prev;
+        }
+    }
+
+    /*!
+     * \brief Pushes a scope exit action.
+     *
+     * The action is copy- or move-constructed into the arena. If construction
+     * or a chunk allocation throws, the stack is unmodified and the previously
+     * pushed actions remain registered.
+     *
+     * **Throws:** \c std::bad_alloc if a new arena chunk cannot be allocated,
+     *             and any exception thrown by the copy/move constructor of the action.
+     */
+    template< typename Func >
+    void push(Func&& func)
+    {
+        typedef node< typename std::decay< Func >::type > node_type;
+
+        unsigned char* const pos = allocate(sizeof(node_type), alignof(node_type));
+        node_type* const p = new (static_cast< void* >(pos)) node_type(m_last_node, static_cast< Func&& >(func));
+
+        // Commit the allocation only after the action is constructed
+        m_pos = pos + sizeof(node_type);
+        m_last_node = p;
+    }
+
+    //! Returns \c true if the stack will invoke the actions on destruction
+    bool active() const noexcept
+    {
+        return m_active;
+    }
+
+    //! Activates or deactivates invocation of all pushed actions
+    void set_active(bool active) noexcept
+    {
+        m_active = active;
+    }
+
+private:
+    //! Returns a pointer to \a size bytes of storage aligned to \a alignment
+    unsigned char* allocate(std::size_t size, std::size_t alignment)
+    {
+        // The alignment padding can step past the end of the chunk, in which
+        // case the remaining capacity must not be computed from the wrapped
+        // pointer difference
+        unsigned char* pos = align_up(m_pos, alignment);
+        if (BOOST_UNLIKELY(pos == nullptr || pos > m_end || static_cast< std::size_t >(m_end - pos) < size))
+        {
+            pos = allocate_chunk(size, alignment);
+        }
+
+        return pos;
+    }
+
+    //! Allocates a new chunk large enough for \a size bytes at \a alignment
+    unsigned char* allocate_chunk(std::size_t size, std::size_t alignment)
+    {
+        std::size_t chunk_size = m_current_chunk != nullptr ? m_current_chunk->size * 2u : m_initial_chunk_size;
+        const std::size_t min_chunk_size = sizeof(chunk_header) + alignment + size;
+        if (chunk_size < min_chunk_size)
+            chunk_size = min_chunk_size;
+
+        chunk_header* const chunk = static_cast< chunk_header* >(::operator new(chunk_size));
+        chunk->prev = m_current_chunk;
+        chunk->size = chunk_size;
+
+        m_current_chunk = chunk;
+        m_pos = reinterpret_cast< unsigned char* >(chunk) + sizeof(chunk_header);
+        m_end = reinterpret_cast< unsigned char* >(chunk) + chunk_size;
+
+        return align_up(m_pos, alignment);
+    }
+
+    static unsigned char* align_up(unsigned char* p, std::size_t alignment) noexcept
+    {
+        return reinterpret_cast< unsigned char* >(
+            (reinterpret_cast< std::size_t >(p) + (alignment - 1u)) & ~(alignment - 1u));
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_SCOPE_GUARD_STACK_HPP_INCLUDED_
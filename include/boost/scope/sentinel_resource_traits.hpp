@@ -0,0 +1,67 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/sentinel_resource_traits.hpp
+ *
+ * This header contains definition of \c sentinel_resource_traits template
+ * for generating \c unique_resource traits from a sentinel value.
+ */
+
+#ifndef BOOST_SCOPE_SENTINEL_RESOURCE_TRAITS_HPP_INCLUDED_
+#define BOOST_SCOPE_SENTINEL_RESOURCE_TRAITS_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Resource traits generated from a compile-time sentinel value.
+ *
+ * For many resource types there is a single value that denotes an unallocated
+ * resource, such as -1 for POSIX file descriptors or a null value for various
+ * handle types. For such resources, this template generates \c unique_resource
+ * traits that use the sentinel as the default value and consider every other
+ * value allocated. This enables the optimized \c unique_resource implementation
+ * that does not store a separate "allocated" flag.
+ *
+ * For example, `sentinel_resource_traits< int, -1 >` is suitable for POSIX-like
+ * file descriptors, provided that negative descriptors other than -1 are never
+ * stored in the \c unique_resource object.
+ *
+ * \tparam Resource Resource type. Must be a structural type usable as a non-type
+ *                  template parameter, such as an integer or enumeration type.
+ * \tparam Sentinel Resource value that indicates an unallocated resource.
+ */
+template< typename Resource, Resource Sentinel >
+struct sentinel_resource_traits
+{
+    //! Creates the default (unallocated) resource value
+    static Resource make_default() noexcept
+    {
+        return Sentinel;
+    }
+
+    //! Tests if the resource value is allocated (i.e. not the sentinel)
+    static bool is_allocated(Resource res) noexcept
+    {
+        return res != Sentinel;
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_SENTINEL_RESOURCE_TRAITS_HPP_INCLUDED_
@@ -0,0 +1,254 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/sharded_cleanup_scheduler.hpp
+ *
+ * This header contains definition of \c sharded_cleanup_scheduler and
+ * \c sharded_deferred_deleter for thread-affine deferred reclamation.
+ */
+
+#ifndef BOOST_SCOPE_SHARDED_CLEANUP_SCHEDULER_HPP_INCLUDED_
+#define BOOST_SCOPE_SHARDED_CLEANUP_SCHEDULER_HPP_INCLUDED_
+
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/deferred_deleter.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+namespace detail {
+
+//! Returns a small dense index identifying the calling thread
+inline std::size_t this_thread_index() noexcept
+{
+    static std::atomic< std::size_t > next_index{ 0u };
+    static thread_local const std::size_t index = next_index.fetch_add(1u, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace detail
+
+/*!
+ * \brief Sharded scheduler for deferred resource reclamation.
+ *
+ * Maintains a fixed set of cache-line-padded \c deferred_cleanup_queue
+ * shards. Each thread is affine to one shard (threads are distributed over
+ * shards round-robin), so resources released by a thread are reclaimed from
+ * the same shard, keeping the deleter's memory accesses cache- and NUMA-local
+ * when the draining thread runs on the same core or node. For NUMA-aware
+ * placement, create the scheduler with one shard per node and drain each
+ * shard from a thread pinned to that node.
+ *
+ * Draining a shard first empties its own queue and, if it was empty, steals
+ * work from the other shards so that queues of exited or stalled threads do
+ * not accumulate garbage. As with \c deferred_cleanup_queue, the scheduler
+ * never starts threads; the application owns the draining threads.
+ */
+class sharded_cleanup_scheduler
+{
+private:
+    /*
+     * Padding the shards avoids false sharing between producer threads
+     * pushing to adjacent queues. The standard constant for this
+     * (std::hardware_destructive_interference_size) is C++17-only, so use
+     * the common 64-byte cache line size.
+     */
+    struct BOOST_ALIGNMENT(64) shard
+    {
+        deferred_cleanup_queue queue;
+    };
+
+private:
+    std::unique_ptr< shard[] > m_shards;
+    std::size_t m_shard_count;
+
+public:
+    /*!
+     * \brief Constructs the scheduler.
+     *
+     * \param shard_count Number of shards, or 0 to use the number of
+     *                    hardware threads.
+     */
+    explicit sharded_cleanup_scheduler(std::size_t shard_count = 0u) :
+        m_shard_count(shard_count)
+    {
+        if (m_shard_count == 0u)
+        {
+            m_shard_count = std::thread::hardware_concurrency();
+            if (m_shard_count == 0u)
+                m_shard_count = 1u;
+        }
+
+        m_shards.reset(new shard[m_shard_count]);
+    }
+
+    sharded_cleanup_scheduler(sharded_cleanup_scheduler const&) = delete;
+    sharded_cleanup_scheduler& operator= (sharded_cleanup_scheduler const&) = delete;
+
+    //! Returns the number of shards
+    std::size_t shard_count() const noexcept
+    {
+        return m_shard_count;
+    }
+
+    //! Returns the shard index the calling thread is affine to
+    std::size_t this_thread_shard() const noexcept
+    {
+        return detail::this_thread_index() % m_shard_count;
+    }
+
+    //! Enqueues a resource on the specified shard
+    template< typename Resource, typename Deleter >
+    void push(std::size_t shard_index, Resource&& res, Deleter&& del)
+    {
+        m_shards[shard_index].queue.push(static_cast< Resource&& >(res), static_cast< Deleter&& >(del));
+    }
+
+    //! Enqueues a resource on the calling thread's shard
+    template< typename Resource, typename Deleter >
+    void push(Resource&& res, Deleter&& del)
+    {
+        push(this_thread_shard(), static_cast< Resource&& >(res), static_cast< Deleter&& >(del));
+    }
+
+    /*!
+     * \brief Drains the specified shard, stealing from other shards if it is empty.
+     *
+     * A given shard must not be drained by multiple threads concurrently.
+     * Work stealing is safe as long as that holds for every shard involved.
+     *
+     * \param shard_index The draining thread's home shard.
+     *
+     * \returns The number of entries drained.
+     */
+    std::size_t drain(std::size_t shard_index) noexcept
+    {
+        std::size_t count = m_shards[shard_index].queue.drain();
+        if (count == 0u)
+        {
+            // The home shard is empty; steal from the others
+            for (std::size_t i = 1u; i < m_shard_count; ++i)
+            {
+                count += m_shards[(shard_index + i) % m_shard_count].queue.drain();
+                if (count > 0u)
+                    break;
+            }
+        }
+
+        return count;
+    }
+
+    //! Drains the calling thread's shard, stealing from other shards if it is empty
+    std::size_t drain() noexcept
+    {
+        return drain(this_thread_shard());
+    }
+
+    /*!
+     * \brief Drains every shard.
+     *
+     * Must not be called concurrently with other \c drain() or \c drain_all()
+     * calls on the same scheduler.
+     *
+     * \returns The number of entries drained.
+     */
+    std::size_t drain_all() noexcept
+    {
+        std::size_t count = 0u;
+        for (std::size_t i = 0u; i < m_shard_count; ++i)
+            count += m_shards[i].queue.drain();
+        return count;
+    }
+};
+
+/*!
+ * \brief Deleter adapter that defers deallocation to a fixed shard of a
+ *        \c sharded_cleanup_scheduler.
+ *
+ * The shard is captured when the adapter is constructed — normally the
+ * creating thread's shard — so the resource is reclaimed from the shard
+ * affine to the thread that allocated it, no matter which thread ends up
+ * destroying the owning \c unique_resource. The referenced scheduler must
+ * outlive every resource using the adapter.
+ *
+ * \tparam Deleter The wrapped deleter type.
+ */
+template< typename Deleter >
+class sharded_deferred_deleter
+{
+public:
+    typedef void result_type;
+
+private:
+    sharded_cleanup_scheduler* m_scheduler;
+    std::size_t m_shard_index;
+    Deleter m_deleter;
+
+public:
+    /*!
+     * \brief Constructs the adapter, pinning deallocations to the calling
+     *        thread's shard.
+     *
+     * \param scheduler Scheduler to defer deallocations to.
+     * \param del Deleter that performs the actual deallocation.
+     */
+    explicit sharded_deferred_deleter(sharded_cleanup_scheduler& scheduler, Deleter const& del = Deleter()) noexcept(std::is_nothrow_copy_constructible< Deleter >::value) :
+        m_scheduler(&scheduler),
+        m_shard_index(scheduler.this_thread_shard()),
+        m_deleter(del)
+    {
+    }
+
+    /*!
+     * \brief Constructs the adapter, pinning deallocations to the specified shard.
+     *
+     * \param scheduler Scheduler to defer deallocations to.
+     * \param shard_index Shard to pin deallocations to.
+     * \param del Deleter that performs the actual deallocation.
+     */
+    sharded_deferred_deleter(sharded_cleanup_scheduler& scheduler, std::size_t shard_index, Deleter const& del = Deleter()) noexcept(std::is_nothrow_copy_constructible< Deleter >::value) :
+        m_scheduler(&scheduler),
+        m_shard_index(shard_index),
+        m_deleter(del)
+    {
+    }
+
+    //! Returns the shard deallocations are pinned to
+    std::size_t shard_index() const noexcept
+    {
+        return m_shard_index;
+    }
+
+    //! Enqueues deallocation of the resource on the pinned shard
+    template< typename Resource >
+    result_type operator() (Resource&& res) const
+    {
+        m_scheduler->push(m_shard_index, static_cast< Resource&& >(res), m_deleter);
+    }
+};
+
+#endif // !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_SHARDED_CLEANUP_SCHEDULER_HPP_INCLUDED_
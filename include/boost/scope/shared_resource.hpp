@@ -0,0 +1,276 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/shared_resource.hpp
+ *
+ * This header contains definition of \c shared_resource, a shared-ownership
+ * companion to \c unique_resource with biased reference counting.
+ */
+
+#ifndef BOOST_SCOPE_SHARED_RESOURCE_HPP_INCLUDED_
+#define BOOST_SCOPE_SHARED_RESOURCE_HPP_INCLUDED_
+
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Shared-ownership resource wrapper with biased reference counting.
+ *
+ * The reference count is split in two: a plain, non-atomic count for
+ * references held by the owner thread (the thread that allocated the
+ * resource), and an atomic count for references held by other threads.
+ * While the owner thread holds references, the shared count carries one
+ * token on their behalf, so the dominant same-thread copy/drop pattern
+ * is a plain increment/decrement with no atomic read-modify-write — unlike
+ * `shared_ptr`, whose refcount traffic is measurable when a long-lived
+ * resource (an mmap region, a cached fd) is copied around dozens of times
+ * per request on its home thread.
+ *
+ * The split imposes one structural rule: a wrapper instance holding an
+ * owner-thread reference must also be destroyed on the owner thread. To
+ * hand a resource to another thread, take the copy with \c share(), which
+ * always counts the reference atomically and can therefore be dropped
+ * anywhere; do not move a plain owner-thread copy across threads.
+ * Violations are diagnosed with an assertion in debug builds.
+ *
+ * The resource is released by invoking the deleter when the last reference,
+ * on whichever thread, is dropped.
+ *
+ * \tparam Resource The resource type.
+ * \tparam Deleter The deleter type.
+ */
+template< typename Resource, typename Deleter >
+class shared_resource
+{
+public:
+    //! Resource type
+    typedef Resource resource_type;
+    //! Deleter type
+    typedef Deleter deleter_type;
+
+private:
+    struct control_block
+    {
+        resource_type resource;
+        deleter_type deleter;
+        //! Thread that allocated the resource; reads a plain count only on this thread
+        std::thread::id owner;
+        //! References held by the owner thread; modified by the owner thread only
+        std::size_t local_count;
+        //! References held by other threads, plus one token while local_count > 0
+        std::atomic< std::size_t > shared_count;
+
+        control_block(resource_type&& res, deleter_type&& del) :
+            resource(static_cast< resource_type&& >(res)),
+            deleter(static_cast< deleter_type&& >(del)),
+            owner(std::this_thread::get_id()),
+            local_count(1u),
+            shared_count(1u)
+        {
+        }
+    };
+
+private:
+    control_block* m_control_block;
+    //! Indicates whether this instance's reference is counted in the owner-thread count
+    bool m_local;
+
+public:
+    /*!
+     * \brief Constructs an empty wrapper that does not own a resource.
+     *
+     * **Throws:** Nothing.
+     */
+    shared_resource() noexcept :
+        m_control_block(nullptr),
+        m_local(false)
+    {
+    }
+
+    /*!
+     * \brief Constructs a wrapper owning the given resource.
+     *
+     * The calling thread becomes the owner thread of the resource.
+     *
+     * **Throws:** `std::bad_alloc` or whatever the resource or deleter move
+     *             constructors throw. On failure, the deleter is invoked on
+     *             the resource before the exception propagates.
+     */
+    explicit shared_resource(resource_type res, deleter_type del = deleter_type()) :
+        m_local(true)
+    {
+        try
+        {
+            m_control_block = new control_block(static_cast< resource_type&& >(res), static_cast< deleter_type&& >(del));
+        }
+        catch (...)
+        {
+            del(res);
+            throw;
+        }
+    }
+
+    /*!
+     * \brief Copies the wrapper, adding a reference to the resource.
+     *
+     * On the owner thread the reference is counted without atomic
+     * read-modify-write operations.
+     *
+     * **Throws:** Nothing.
+     */
+    shared_resource(shared_resource const& that) noexcept :
+        m_control_block(that.m_control_block),
+        m_local(false)
+    {
+        if (m_control_block)
+            add_ref();
+    }
+
+    //! Transfers the reference from \a that
+    shared_resource(shared_resource&& that) noexcept :
+        m_control_block(that.m_control_block),
+        m_local(that.m_local)
+    {
+        that.m_control_block = nullptr;
+        that.m_local = false;
+    }
+
+    shared_resource& operator= (shared_resource&&) = delete;
+    shared_resource& operator= (shared_resource const&) = delete;
+
+    /*!
+     * \brief Drops the reference; releases the resource if it was the last one.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    ~shared_resource()
+    {
+        if (m_control_block)
+            drop_ref();
+    }
+
+    //! Returns \c true if the wrapper holds a resource
+    bool allocated() const noexcept
+    {
+        return m_control_block != nullptr;
+    }
+
+    //! Returns the owned resource
+    resource_type const& get() const noexcept
+    {
+        BOOST_ASSERT(m_control_block != nullptr);
+        return m_control_block->resource;
+    }
+
+    /*!
+     * \brief Returns a copy whose reference is always counted atomically.
+     *
+     * Unlike plain copies, the returned wrapper may be moved to and dropped
+     * on any thread, which makes it the right way to hand the resource to
+     * another thread.
+     *
+     * **Throws:** Nothing.
+     */
+    shared_resource share() const noexcept
+    {
+        BOOST_ASSERT(m_control_block != nullptr);
+        m_control_block->shared_count.fetch_add(1u, std::memory_order_relaxed);
+
+        shared_resource copy;
+        copy.m_control_block = m_control_block;
+        return copy;
+    }
+
+    /*!
+     * \brief Drops the reference and leaves the wrapper empty.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    void reset()
+    {
+        if (m_control_block)
+        {
+            drop_ref();
+            m_control_block = nullptr;
+            m_local = false;
+        }
+    }
+
+private:
+    //! Adds a reference on the calling thread
+    void add_ref() noexcept
+    {
+        control_block* const cb = m_control_block;
+        if (std::this_thread::get_id() == cb->owner)
+        {
+            // Only the owner thread reads or writes local_count, so no
+            // synchronization is needed. A zero count means the owner token
+            // was released earlier and has to be re-acquired.
+            if (BOOST_LIKELY(cb->local_count > 0u))
+            {
+                ++cb->local_count;
+            }
+            else
+            {
+                cb->shared_count.fetch_add(1u, std::memory_order_relaxed);
+                cb->local_count = 1u;
+            }
+
+            m_local = true;
+        }
+        else
+        {
+            cb->shared_count.fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+
+    //! Drops a reference on the calling thread
+    void drop_ref() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        control_block* const cb = m_control_block;
+        if (m_local)
+        {
+            BOOST_ASSERT_MSG(std::this_thread::get_id() == cb->owner,
+                "boost::scope::shared_resource: an owner-thread reference was dropped on a different thread; "
+                "copy the wrapper to share the resource across threads instead of moving it");
+
+            if (BOOST_LIKELY(--cb->local_count > 0u))
+                return;
+            // The owner released its last local reference; give up the token
+        }
+
+        // Note: acq_rel on the decrement rather than the release + acquire
+        // fence idiom, which ThreadSanitizer does not understand and reports
+        // as a race between the deletion and other threads' accesses
+        if (cb->shared_count.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        {
+            cb->deleter(cb->resource);
+            delete cb;
+        }
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_SHARED_RESOURCE_HPP_INCLUDED_
@@ -0,0 +1,99 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/status_flag_checker.hpp
+ *
+ * This header contains definition of \c status_flag_checker type.
+ */
+
+#ifndef BOOST_SCOPE_STATUS_FLAG_CHECKER_HPP_INCLUDED_
+#define BOOST_SCOPE_STATUS_FLAG_CHECKER_HPP_INCLUDED_
+
+#include <boost/core/addressof.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A predicate for checking whether a plain status flag indicates failure.
+ *
+ * The predicate captures a reference to an external status flag of a scalar
+ * type, typically `int` or `bool`, which it tests for a failure indication
+ * when called. The flag must remain valid for the whole lifetime duration of
+ * the predicate.
+ *
+ * A value-initialized flag (zero for `int`, `false` for `bool`) indicates
+ * success; any other value indicates failure, and the predicate returns `true`.
+ *
+ * The predicate is a single pointer in size, which makes it preferable to
+ * \c error_code_checker for C APIs that report errors through an `int` status
+ * or a `bool`, where materializing an `error_code` object would only add
+ * stack footprint.
+ *
+ * \tparam Flag Status flag type.
+ */
+template< typename Flag >
+class status_flag_checker
+{
+public:
+    //! Predicate result type
+    typedef bool result_type;
+
+private:
+    Flag* m_flag;
+
+public:
+    /*!
+     * \brief Constructs the predicate.
+     *
+     * Upon construction, the predicate saves a reference to the external status flag.
+     * The referenced flag must remain valid for the whole lifetime duration of the predicate.
+     *
+     * **Throws:** Nothing.
+     */
+    explicit status_flag_checker(Flag& flag) noexcept :
+        m_flag(boost::addressof(flag))
+    {
+    }
+
+    /*!
+     * \brief Checks if the status flag indicates failure.
+     *
+     * **Throws:** Nothing.
+     *
+     * \returns `true` if the referenced flag is not equal to a value-initialized `Flag`, otherwise `false`.
+     */
+    result_type operator()() const noexcept
+    {
+        return *m_flag != Flag();
+    }
+};
+
+/*!
+ * \brief Creates a predicate for checking whether a status flag indicates failure
+ *
+ * **Throws:** Nothing.
+ */
+template< typename Flag >
+inline status_flag_checker< Flag > check_status_flag(Flag& flag) noexcept
+{
+    return status_flag_checker< Flag >(flag);
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_STATUS_FLAG_CHECKER_HPP_INCLUDED_
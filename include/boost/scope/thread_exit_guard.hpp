@@ -0,0 +1,221 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/thread_exit_guard.hpp
+ *
+ * This header contains definition of \c thread_exit_guard template.
+ */
+
+#ifndef BOOST_SCOPE_THREAD_EXIT_GUARD_HPP_INCLUDED_
+#define BOOST_SCOPE_THREAD_EXIT_GUARD_HPP_INCLUDED_
+
+#include <new>
+#include <type_traits>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/is_not_like.hpp>
+#include <boost/scope/detail/move_or_copy_construct_ref.hpp>
+#include <boost/scope/detail/type_traits/conjunction.hpp>
+#include <boost/scope/detail/type_traits/is_nothrow_invocable.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+template< typename Func >
+class thread_exit_guard;
+
+namespace detail {
+
+// Workaround for clang < 5.0 which can't pass thread_exit_guard as a template template parameter from within thread_exit_guard definition
+template< typename T >
+using is_not_like_thread_exit_guard = detail::is_not_like< T, thread_exit_guard >;
+
+//! Thread-local slot holding a registered thread exit action
+template< typename Func >
+class thread_exit_slot
+{
+private:
+    //! Storage for the action, constructed in place upon registration
+    typename std::aligned_storage< sizeof(Func), alignof(Func) >::type m_storage;
+    bool m_engaged;
+
+public:
+    thread_exit_slot() noexcept :
+        m_engaged(false)
+    {
+    }
+
+    thread_exit_slot(thread_exit_slot const&) = delete;
+    thread_exit_slot& operator= (thread_exit_slot const&) = delete;
+
+    //! Invokes the registered action, if any, at thread exit
+    ~thread_exit_slot() noexcept(detail::is_nothrow_invocable< Func& >::value)
+    {
+        if (m_engaged)
+        {
+            Func* const func = reinterpret_cast< Func* >(&m_storage);
+            func->operator()();
+            func->~Func();
+        }
+    }
+
+    bool engaged() const noexcept
+    {
+        return m_engaged;
+    }
+
+    //! Constructs the action in the slot. The slot must not be engaged.
+    template< typename F >
+    void engage(F&& func) noexcept(std::is_nothrow_constructible< Func, F >::value)
+    {
+        new (static_cast< void* >(&m_storage)) Func(static_cast< F&& >(func));
+        m_engaged = true;
+    }
+};
+
+} // namespace detail
+
+/*!
+ * \brief Scope guard that registers a function to be invoked once, at thread exit.
+ *
+ * The guard wraps a function object callable with no arguments, with the same
+ * requirements as \c scope_final. Unlike \c scope_final, which invokes the
+ * function on every scope exit, the guard registers the function in a
+ * preallocated thread-local slot associated with the function object type and
+ * runs it when the current thread terminates. The registration is idempotent:
+ * the first guard constructed in a thread stores the function, and every
+ * subsequent construction in the same thread is a single flag check. This
+ * allows placing the guard on a per-call fast path while paying for the
+ * cleanup once per thread lifetime.
+ *
+ * There is one slot per function object type per thread, so actions of
+ * distinct types registered in the same thread run independently. The slot
+ * is inline in thread-local storage; no dynamic memory is allocated.
+ *
+ * If the function object construction throws during the registering
+ * construction, the function is invoked before the exception propagates,
+ * same as in \c scope_final.
+ *
+ * \tparam Func Type of the function object to invoke at thread exit.
+ */
+template< typename Func >
+class thread_exit_guard
+{
+private:
+    //! Indicates whether this construction performed the registration
+    bool m_registered;
+
+public:
+    /*!
+     * \brief Registers the function object to be invoked at thread exit, unless one is already registered.
+     *
+     * **Requires:** \c Func is constructible from \a func.
+     *
+     * **Effects:** If no function object of type \c Func is registered in the current
+     *              thread, constructs \c Func from `std::forward< F >(func)` in the
+     *              thread-local slot. Otherwise, the constructor has no effect.
+     *
+     *              If \c Func construction throws, invokes \a func before returning
+     *              with the exception.
+     *
+     * **Throws:** Nothing, unless construction of the function object throws.
+     *
+     * \param func The callable function object to invoke at thread exit.
+     */
+    template<
+        typename F
+        //! \cond
+        , typename = typename std::enable_if< detail::conjunction<
+            std::is_constructible< Func, typename detail::move_or_copy_construct_ref< F, Func >::type >,
+            detail::is_not_like_thread_exit_guard< F >
+        >::value >::type
+        //! \endcond
+    >
+    thread_exit_guard(F&& func)
+        noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
+            std::is_nothrow_constructible< Func, typename detail::move_or_copy_construct_ref< F, Func >::type >::value
+        )) :
+        m_registered(false)
+    {
+        register_action(
+            static_cast< typename detail::move_or_copy_construct_ref< F, Func >::type >(func),
+            typename std::is_nothrow_constructible< Func, typename detail::move_or_copy_construct_ref< F, Func >::type >::type());
+    }
+
+    thread_exit_guard(thread_exit_guard const&) = delete;
+    thread_exit_guard& operator= (thread_exit_guard const&) = delete;
+
+    /*!
+     * \brief Returns \c true if this guard construction registered the action.
+     *
+     * **Throws:** Nothing.
+     */
+    bool registered() const noexcept
+    {
+        return m_registered;
+    }
+
+//! \cond
+private:
+    //! Registers the nothrow-constructible action
+    template< typename F >
+    void register_action(F&& func, std::true_type) noexcept
+    {
+        detail::thread_exit_slot< Func >& slot = this_thread_slot();
+        if (!slot.engaged())
+        {
+            slot.engage(static_cast< F&& >(func));
+            m_registered = true;
+        }
+    }
+
+    //! Registers the action, invoking it if the construction in the slot throws
+    template< typename F >
+    void register_action(F&& func, std::false_type)
+    {
+        detail::thread_exit_slot< Func >& slot = this_thread_slot();
+        if (!slot.engaged())
+        {
+            try
+            {
+                slot.engage(static_cast< F&& >(func));
+            }
+            catch (...)
+            {
+                func();
+                throw;
+            }
+
+            m_registered = true;
+        }
+    }
+
+    //! Returns the thread-local slot for the function object type
+    static detail::thread_exit_slot< Func >& this_thread_slot() noexcept
+    {
+        static thread_local detail::thread_exit_slot< Func > slot;
+        return slot;
+    }
+//! \endcond
+};
+
+#if !defined(BOOST_NO_CXX17_DEDUCTION_GUIDES)
+template< typename Func >
+thread_exit_guard(Func) -> thread_exit_guard< Func >;
+#endif // !defined(BOOST_NO_CXX17_DEDUCTION_GUIDES)
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_THREAD_EXIT_GUARD_HPP_INCLUDED_
@@ -0,0 +1,164 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/unique_epoll_registration.hpp
+ *
+ * This header contains definition of \c unique_epoll_registration type for
+ * owning a file descriptor together with its epoll registration. The header
+ * is empty on non-Linux systems.
+ */
+
+#ifndef BOOST_SCOPE_UNIQUE_EPOLL_REGISTRATION_HPP_INCLUDED_
+#define BOOST_SCOPE_UNIQUE_EPOLL_REGISTRATION_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if defined(__linux__)
+
+#include <sys/epoll.h>
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/scope/fd_deleter.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A file descriptor paired with the epoll instance it is registered with.
+ */
+struct epoll_registration
+{
+    //! The epoll instance descriptor
+    int epoll_fd;
+    //! The registered descriptor
+    int fd;
+};
+
+/*!
+ * \brief Deleter for epoll-registered file descriptors.
+ *
+ * The kernel removes a descriptor from every epoll interest list when the
+ * last reference to the underlying open file description is closed, so by
+ * default the deleter only closes the descriptor — one syscall per teardown
+ * instead of the `EPOLL_CTL_DEL` + `close` pair.
+ *
+ * That shortcut is only correct when the descriptor is the sole reference
+ * to the open file description. For descriptors that may have been
+ * duplicated (`dup(2)`, inherited over `fork(2)`, passed over a socket),
+ * construct the deleter with \a explicit_deregister set to `true` to issue
+ * `EPOLL_CTL_DEL` before closing.
+ *
+ * The deleter supports the batch protocol; batched teardown coalesces the
+ * close calls through \c close_fds().
+ */
+class epoll_registration_deleter
+{
+public:
+    typedef void result_type;
+
+private:
+    bool m_explicit_deregister;
+
+public:
+    //! Constructs the deleter
+    explicit epoll_registration_deleter(bool explicit_deregister = false) noexcept :
+        m_explicit_deregister(explicit_deregister)
+    {
+    }
+
+    //! Deregisters, if requested, and closes the descriptor
+    result_type operator() (epoll_registration const& reg) const noexcept
+    {
+        if (BOOST_UNLIKELY(m_explicit_deregister))
+            ::epoll_ctl(reg.epoll_fd, EPOLL_CTL_DEL, reg.fd, nullptr);
+
+        fd_deleter()(reg.fd);
+    }
+
+    //! Tears down a batch of registrations, coalescing the close calls
+    result_type operator() (const epoll_registration* regs, std::size_t count) const noexcept
+    {
+        if (BOOST_UNLIKELY(m_explicit_deregister))
+        {
+            for (std::size_t i = 0u; i < count; ++i)
+                ::epoll_ctl(regs[i].epoll_fd, EPOLL_CTL_DEL, regs[i].fd, nullptr);
+        }
+
+        while (count > 0u)
+        {
+            int batch[256];
+            const std::size_t n = count < 256u ? count : std::size_t(256u);
+            for (std::size_t i = 0u; i < n; ++i)
+                batch[i] = regs[i].fd;
+
+            boost::scope::close_fds(batch, n);
+            regs += n;
+            count -= n;
+        }
+    }
+};
+
+//! Epoll registration resource traits
+struct epoll_registration_resource_traits
+{
+    //! Creates a default (unallocated) registration value
+    static epoll_registration make_default() noexcept
+    {
+        epoll_registration reg = { -1, -1 };
+        return reg;
+    }
+
+    //! Tests if the registration is allocated
+    static bool is_allocated(epoll_registration const& reg) noexcept
+    {
+        return reg.fd >= 0;
+    }
+};
+
+//! Unique epoll-registered file descriptor resource
+typedef unique_resource< epoll_registration, epoll_registration_deleter, epoll_registration_resource_traits > unique_epoll_registration;
+
+/*!
+ * \brief Registers the descriptor with the epoll instance and wraps both in a \c unique_epoll_registration.
+ *
+ * On failure an unallocated wrapper is returned and the descriptor is not
+ * consumed; `errno` is set by `epoll_ctl(2)`.
+ *
+ * \param epoll_fd The epoll instance descriptor.
+ * \param fd The descriptor to register; ownership is taken on success.
+ * \param events Pointer to the epoll event description for the descriptor.
+ * \param explicit_deregister Whether teardown must issue `EPOLL_CTL_DEL` explicitly.
+ *
+ * **Throws:** Nothing.
+ */
+inline unique_epoll_registration register_with_epoll(int epoll_fd, int fd, ::epoll_event* events, bool explicit_deregister = false) noexcept
+{
+    unique_epoll_registration reg;
+    if (BOOST_LIKELY(::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, events) == 0))
+    {
+        epoll_registration res = { epoll_fd, fd };
+        reg = unique_epoll_registration(res, epoll_registration_deleter(explicit_deregister));
+    }
+
+    return reg;
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // defined(__linux__)
+
+#endif // BOOST_SCOPE_UNIQUE_EPOLL_REGISTRATION_HPP_INCLUDED_
@@ -30,6 +30,16 @@ namespace scope {
 //! Unique POSIX-like file descriptor resource
 typedef unique_resource< int, fd_deleter, fd_resource_traits > unique_fd;
 
+#if defined(BOOST_SCOPE_SEPARATE_COMPILATION)
+/*
+ * When separate compilation is enabled, the unique_fd specialization of
+ * unique_resource is instantiated once in the compiled library
+ * (src/unique_fd.cpp) instead of in every translation unit that includes
+ * this header.
+ */
+extern template class unique_resource< int, fd_deleter, fd_resource_traits >;
+#endif // defined(BOOST_SCOPE_SEPARATE_COMPILATION)
+
 } // namespace scope
 } // namespace boost
 
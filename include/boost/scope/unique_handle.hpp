@@ -0,0 +1,75 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/unique_handle.hpp
+ *
+ * This header contains definition of \c unique_handle type for Windows
+ * \c HANDLE resources. The header is empty on non-Windows systems.
+ */
+
+#ifndef BOOST_SCOPE_UNIQUE_HANDLE_HPP_INCLUDED_
+#define BOOST_SCOPE_UNIQUE_HANDLE_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if defined(BOOST_WINDOWS)
+
+#include <boost/winapi/basic_types.hpp>
+#include <boost/winapi/handles.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+//! Windows \c HANDLE deleter
+struct handle_deleter
+{
+    typedef void result_type;
+
+    //! Closes the handle
+    result_type operator() (boost::winapi::HANDLE_ handle) const noexcept
+    {
+        boost::winapi::CloseHandle(handle);
+    }
+};
+
+//! Windows \c HANDLE resource traits
+struct handle_resource_traits
+{
+    //! Creates a default handle value
+    static boost::winapi::HANDLE_ make_default() noexcept
+    {
+        return boost::winapi::INVALID_HANDLE_VALUE_;
+    }
+
+    //! Tests if the handle is allocated (valid)
+    static bool is_allocated(boost::winapi::HANDLE_ handle) noexcept
+    {
+        // Windows APIs are inconsistent in the invalid handle value they return:
+        // e.g. CreateFile returns INVALID_HANDLE_VALUE on failure, while
+        // CreateEvent and OpenProcess return a null handle. Treat both as unallocated.
+        return handle != boost::winapi::INVALID_HANDLE_VALUE_ && handle != static_cast< boost::winapi::HANDLE_ >(0);
+    }
+};
+
+//! Unique Windows \c HANDLE resource
+typedef unique_resource< boost::winapi::HANDLE_, handle_deleter, handle_resource_traits > unique_handle;
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // defined(BOOST_WINDOWS)
+
+#endif // BOOST_SCOPE_UNIQUE_HANDLE_HPP_INCLUDED_
@@ -0,0 +1,135 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/unique_mapped_region.hpp
+ *
+ * This header contains definition of \c unique_mapped_region type for
+ * POSIX memory mappings. The header is empty on Windows.
+ */
+
+#ifndef BOOST_SCOPE_UNIQUE_MAPPED_REGION_HPP_INCLUDED_
+#define BOOST_SCOPE_UNIQUE_MAPPED_REGION_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <cstddef>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief Memory-mapped region descriptor.
+ *
+ * Bundles the mapping address and length so that the length needed by
+ * `munmap` is carried in the resource itself rather than in a per-mapping
+ * deleter closure.
+ */
+struct mapped_region
+{
+    //! Starting address of the mapping, or \c MAP_FAILED if not allocated
+    void* address;
+    //! Length of the mapping, in bytes
+    std::size_t size;
+};
+
+//! Memory-mapped region deleter
+struct mapped_region_deleter
+{
+    typedef void result_type;
+
+    //! Unmaps the region
+    result_type operator() (mapped_region const& region) const noexcept
+    {
+        ::munmap(region.address, region.size);
+    }
+};
+
+//! Memory-mapped region resource traits
+struct mapped_region_resource_traits
+{
+    //! Creates a default (unallocated) region value
+    static mapped_region make_default() noexcept
+    {
+        mapped_region region = { MAP_FAILED, 0u };
+        return region;
+    }
+
+    //! Tests if the region is allocated (valid)
+    static bool is_allocated(mapped_region const& region) noexcept
+    {
+        return region.address != MAP_FAILED;
+    }
+};
+
+//! Unique POSIX memory-mapped region resource
+typedef unique_resource< mapped_region, mapped_region_deleter, mapped_region_resource_traits > unique_mapped_region;
+
+/*!
+ * \brief Creates a memory mapping wrapped in a \c unique_mapped_region.
+ *
+ * The arguments are forwarded to `mmap`. On failure, `mmap` returns
+ * \c MAP_FAILED, which the resource traits recognize as an unallocated
+ * region, so the returned \c unique_mapped_region is inactive and the
+ * caller can inspect `errno`.
+ *
+ * On Linux, \c MAP_HUGETLB (possibly combined with a huge page size
+ * selector such as \c MAP_HUGE_2MB) can be included in \a flags to request
+ * a huge page mapping.
+ *
+ * \param size Length of the mapping, in bytes.
+ * \param prot Memory protection flags (e.g. `PROT_READ | PROT_WRITE`).
+ * \param flags Mapping flags (e.g. `MAP_PRIVATE | MAP_ANONYMOUS`).
+ * \param fd File descriptor to map, or -1 for anonymous mappings.
+ * \param offset Offset in the file, in bytes. Must be a multiple of the page size.
+ *
+ * **Throws:** Nothing.
+ */
+inline unique_mapped_region map_region(std::size_t size, int prot, int flags, int fd = -1, off_t offset = 0) noexcept
+{
+    mapped_region region = { ::mmap(nullptr, size, prot, flags, fd, offset), size };
+    return unique_mapped_region(region);
+}
+
+/*!
+ * \brief Applies a `madvise` hint to the mapped region.
+ *
+ * Has no effect if the region is not allocated.
+ *
+ * \param region Region to advise on.
+ * \param advice Advice flag (e.g. `MADV_SEQUENTIAL`, `MADV_WILLNEED` or,
+ *               on Linux, `MADV_HUGEPAGE`).
+ *
+ * \returns \c true if the advice was applied successfully, otherwise \c false.
+ *
+ * **Throws:** Nothing.
+ */
+inline bool advise_region(unique_mapped_region const& region, int advice) noexcept
+{
+    if (!region.allocated())
+        return false;
+    return ::madvise(region.get().address, region.get().size, advice) == 0;
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // !defined(BOOST_WINDOWS)
+
+#endif // BOOST_SCOPE_UNIQUE_MAPPED_REGION_HPP_INCLUDED_
@@ -22,6 +22,7 @@
 #include <boost/scope/detail/compact_storage.hpp>
 #include <boost/scope/detail/move_or_copy_assign_ref.hpp>
 #include <boost/scope/detail/move_or_copy_construct_ref.hpp>
+#include <boost/scope/detail/profile.hpp>
 #include <boost/scope/detail/type_traits/is_swappable.hpp>
 #include <boost/scope/detail/type_traits/is_nothrow_swappable.hpp>
 #include <boost/scope/detail/type_traits/negation.hpp>
@@ -72,7 +73,7 @@ public:
     {
     }
 
-    ref_wrapper& operator= (T& value) noexcept
+    BOOST_SCOPE_CXX20_CONSTEXPR ref_wrapper& operator= (T& value) noexcept
     {
         m_value = boost::addressof(value);
         return *this;
@@ -87,7 +88,7 @@ public:
     }
 
     template< typename... Args >
-    void operator() (Args&&... args) const noexcept(noexcept(std::declval< T& >()(std::declval< Args&& >()...)))
+    BOOST_SCOPE_CXX20_CONSTEXPR void operator() (Args&&... args) const noexcept(noexcept(std::declval< T& >()(std::declval< Args&& >()...)))
     {
         (*m_value)(static_cast< Args&& >(args)...);
     }
@@ -157,7 +158,7 @@ public:
         typename R,
         typename = typename std::enable_if< std::is_constructible< internal_resource_type, R >::value >::type
     >
-    explicit resource_holder(R&& res) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
         resource_base(static_cast< R&& >(res))
     {
     }
@@ -167,40 +168,40 @@ public:
         typename D,
         typename = typename std::enable_if< std::is_constructible< internal_resource_type, R >::value >::type
     >
-    explicit resource_holder(R&& res, D&& del, bool allocated) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res, D&& del, bool allocated) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
         resource_holder(static_cast< R&& >(res), static_cast< D&& >(del), allocated, typename std::is_nothrow_constructible< resource_type, R >::type())
     {
     }
 
-    resource_type& get() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type& get() noexcept
     {
         return resource_base::get();
     }
 
-    resource_type const& get() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type const& get() const noexcept
     {
         return resource_base::get();
     }
 
-    internal_resource_type& get_internal() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type& get_internal() noexcept
     {
         return resource_base::get();
     }
 
-    internal_resource_type const& get_internal() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type const& get_internal() const noexcept
     {
         return resource_base::get();
     }
 
 private:
     template< typename R, typename D >
-    explicit resource_holder(R&& res, D&& del, bool allocated, std::true_type) noexcept :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res, D&& del, bool allocated, std::true_type) noexcept :
         resource_base(static_cast< R&& >(res))
     {
     }
 
     template< typename R, typename D >
-    explicit resource_holder(R&& res, D&& del, bool allocated, std::false_type) try :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res, D&& del, bool allocated, std::false_type) try :
         resource_base(static_cast< R&& >(res))
     {
     }
@@ -235,7 +236,7 @@ public:
         typename R,
         typename = typename std::enable_if< std::is_constructible< internal_resource_type, R >::value >::type
     >
-    explicit resource_holder(R&& res) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
         resource_base(static_cast< R&& >(res))
     {
     }
@@ -245,40 +246,40 @@ public:
         typename D,
         typename = typename std::enable_if< std::is_constructible< internal_resource_type, R >::value >::type
     >
-    explicit resource_holder(R&& res, D&& del, bool allocated) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res, D&& del, bool allocated) noexcept(std::is_nothrow_constructible< internal_resource_type, R >::value) :
         resource_holder(static_cast< R&& >(res), static_cast< D&& >(del), allocated, typename std::is_nothrow_constructible< internal_resource_type, R >::type())
     {
     }
 
-    resource_type& get() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type& get() noexcept
     {
         return resource_base::get();
     }
 
-    resource_type const& get() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type const& get() const noexcept
     {
         return resource_base::get();
     }
 
-    internal_resource_type& get_internal() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type& get_internal() noexcept
     {
         return resource_base::get();
     }
 
-    internal_resource_type const& get_internal() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type const& get_internal() const noexcept
     {
         return resource_base::get();
     }
 
 private:
     template< typename R, typename D >
-    explicit resource_holder(R&& res, D&& del, bool allocated, std::true_type) noexcept :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res, D&& del, bool allocated, std::true_type) noexcept :
         resource_base(static_cast< R&& >(res))
     {
     }
 
     template< typename R, typename D >
-    explicit resource_holder(R&& res, D&& del, bool allocated, std::false_type) try :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit resource_holder(R&& res, D&& del, bool allocated, std::false_type) try :
         resource_base(static_cast< R&& >(res))
     {
     }
@@ -313,7 +314,7 @@ public:
         typename D,
         typename = typename std::enable_if< std::is_constructible< internal_deleter_type, D >::value >::type
     >
-    explicit deleter_holder(D&& del) noexcept(std::is_nothrow_constructible< internal_deleter_type, D >::value) :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit deleter_holder(D&& del) noexcept(std::is_nothrow_constructible< internal_deleter_type, D >::value) :
         deleter_base(static_cast< D&& >(del))
     {
     }
@@ -322,40 +323,40 @@ public:
         typename D,
         typename = typename std::enable_if< std::is_constructible< internal_deleter_type, D >::value >::type
     >
-    explicit deleter_holder(D&& del, resource_type& res, bool allocated) noexcept(std::is_nothrow_constructible< internal_deleter_type, D >::value) :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit deleter_holder(D&& del, resource_type& res, bool allocated) noexcept(std::is_nothrow_constructible< internal_deleter_type, D >::value) :
         deleter_holder(static_cast< D&& >(del), res, allocated, typename std::is_nothrow_constructible< internal_deleter_type, D >::type())
     {
     }
 
-    deleter_type& get() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type& get() noexcept
     {
         return deleter_base::get();
     }
 
-    deleter_type const& get() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type const& get() const noexcept
     {
         return deleter_base::get();
     }
 
-    internal_deleter_type& get_internal() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_deleter_type& get_internal() noexcept
     {
         return deleter_base::get();
     }
 
-    internal_deleter_type const& get_internal() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_deleter_type const& get_internal() const noexcept
     {
         return deleter_base::get();
     }
 
 private:
     template< typename D >
-    explicit deleter_holder(D&& del, resource_type& res, bool allocated, std::true_type) noexcept :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit deleter_holder(D&& del, resource_type& res, bool allocated, std::true_type) noexcept :
         deleter_base(static_cast< D&& >(del))
     {
     }
 
     template< typename D >
-    explicit deleter_holder(D&& del, resource_type& res, bool allocated, std::false_type) try :
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit deleter_holder(D&& del, resource_type& res, bool allocated, std::false_type) try :
         deleter_base(static_cast< D&& >(del))
     {
     }
@@ -418,7 +419,7 @@ public:
         >::value,
         typename = typename std::enable_if< Requires >::type
     >
-    unique_resource_data(unique_resource_data&& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource_data(unique_resource_data&& that)
         noexcept(detail::conjunction<
             std::is_nothrow_constructible< internal_resource_type, typename detail::move_or_copy_construct_ref< resource_type >::type >,
             std::is_nothrow_constructible< internal_deleter_type, typename detail::move_or_copy_construct_ref< deleter_type >::type >
@@ -438,7 +439,7 @@ public:
             std::is_constructible< deleter_holder, D >
         >::value >::type
     >
-    explicit unique_resource_data(default_resource_t, D&& del)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit unique_resource_data(default_resource_t, D&& del)
         noexcept(detail::conjunction<
             std::is_nothrow_default_constructible< resource_holder >,
             std::is_nothrow_constructible< deleter_holder, D >
@@ -458,7 +459,7 @@ public:
             std::is_constructible< deleter_holder, D, resource_type&, bool >
         >::value >::type
     >
-    explicit unique_resource_data(R&& res, D&& del)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit unique_resource_data(R&& res, D&& del)
         noexcept(detail::conjunction<
             std::is_nothrow_constructible< resource_holder, R, D, bool >,
             std::is_nothrow_constructible< deleter_holder, D, resource_type&, bool >
@@ -485,58 +486,58 @@ public:
         return *this;
     }
 
-    resource_type& get_resource() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type& get_resource() noexcept
     {
         return resource_holder::get();
     }
 
-    resource_type const& get_resource() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type const& get_resource() const noexcept
     {
         return resource_holder::get();
     }
 
-    internal_resource_type& get_internal_resource() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type& get_internal_resource() noexcept
     {
         return resource_holder::get_internal();
     }
 
-    internal_resource_type const& get_internal_resource() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type const& get_internal_resource() const noexcept
     {
         return resource_holder::get_internal();
     }
 
-    deleter_type& get_deleter() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type& get_deleter() noexcept
     {
         return deleter_holder::get();
     }
 
-    deleter_type const& get_deleter() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type const& get_deleter() const noexcept
     {
         return deleter_holder::get();
     }
 
-    internal_deleter_type& get_internal_deleter() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_deleter_type& get_internal_deleter() noexcept
     {
         return deleter_holder::get_internal();
     }
 
-    internal_deleter_type const& get_internal_deleter() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_deleter_type const& get_internal_deleter() const noexcept
     {
         return deleter_holder::get_internal();
     }
 
-    bool is_allocated() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR bool is_allocated() const noexcept
     {
         return m_allocated;
     }
 
-    void set_deallocated() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void set_deallocated() noexcept
     {
         m_allocated = false;
     }
 
     template< typename R >
-    void assign_resource(R&& res) noexcept(std::is_nothrow_assignable< internal_resource_type&, R >::value)
+    BOOST_SCOPE_CXX20_CONSTEXPR void assign_resource(R&& res) noexcept(std::is_nothrow_assignable< internal_resource_type&, R >::value)
     {
         get_internal_resource() = static_cast< R&& >(res);
         m_allocated = true;
@@ -552,7 +553,7 @@ public:
             >
         >::value
     >
-    typename std::enable_if< Requires >::type swap(unique_resource_data& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR typename std::enable_if< Requires >::type swap(unique_resource_data& that)
         noexcept(detail::conjunction< detail::is_nothrow_swappable< internal_resource_type >, detail::is_nothrow_swappable< internal_deleter_type > >::value)
     {
         swap_impl
@@ -576,7 +577,7 @@ private:
         that.m_allocated = false;
     }
 
-    unique_resource_data(unique_resource_data&& that, std::false_type) try :
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource_data(unique_resource_data&& that, std::false_type) try :
         resource_holder(static_cast< typename detail::move_or_copy_construct_ref< resource_type >::type >(that.get_resource())),
         deleter_holder(static_cast< typename detail::move_or_copy_construct_ref< deleter_type >::type >(that.get_deleter()), resource_holder::get(),
             std::is_nothrow_constructible< internal_resource_type, resource_type&& >::value && that.m_allocated), // don't deallocate if the resource was copy-constructed
@@ -594,7 +595,7 @@ private:
         }
     }
 
-    void assign(unique_resource_data&& that, std::true_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void assign(unique_resource_data&& that, std::true_type)
         noexcept(std::is_nothrow_assignable< internal_resource_type&, typename detail::move_or_copy_assign_ref< resource_type >::type >::value)
     {
         get_internal_resource() = static_cast< typename detail::move_or_copy_assign_ref< resource_type >::type >(that.get_resource());
@@ -604,7 +605,7 @@ private:
         that.m_allocated = false;
     }
 
-    void assign(unique_resource_data&& that, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void assign(unique_resource_data&& that, std::false_type)
     {
         get_internal_deleter() = static_cast< typename detail::move_or_copy_assign_ref< deleter_type >::type >(that.get_deleter());
         get_internal_resource() = static_cast< typename detail::move_or_copy_assign_ref< resource_type >::type >(that.get_resource());
@@ -613,7 +614,7 @@ private:
         that.m_allocated = false;
     }
 
-    void swap_impl(unique_resource_data& that, std::true_type, std::true_type) noexcept
+    BOOST_SCOPE_CXX20_CONSTEXPR void swap_impl(unique_resource_data& that, std::true_type, std::true_type) noexcept
     {
         boost::core::invoke_swap(get_internal_resource(), that.get_internal_resource());
         boost::core::invoke_swap(get_internal_deleter(), that.get_internal_deleter());
@@ -623,7 +624,7 @@ private:
         that.m_allocated = allocated;
     }
 
-    void swap_impl(unique_resource_data& that, std::true_type, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void swap_impl(unique_resource_data& that, std::true_type, std::false_type)
     {
         boost::core::invoke_swap(get_internal_resource(), that.get_internal_resource());
         try
@@ -641,7 +642,7 @@ private:
         that.m_allocated = allocated;
     }
 
-    void swap_impl(unique_resource_data& that, std::false_type, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void swap_impl(unique_resource_data& that, std::false_type, std::false_type)
     {
         boost::core::invoke_swap(get_internal_deleter(), that.get_internal_deleter());
         try
@@ -689,7 +690,7 @@ public:
     unique_resource_data(unique_resource_data const&) = delete;
     unique_resource_data& operator= (unique_resource_data const&) = delete;
 
-    unique_resource_data(unique_resource_data&& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource_data(unique_resource_data&& that)
         noexcept(detail::conjunction<
             std::is_nothrow_constructible< internal_resource_type, typename detail::move_or_copy_construct_ref< resource_type >::type >,
             std::is_nothrow_constructible< internal_deleter_type, typename detail::move_or_copy_construct_ref< deleter_type >::type >
@@ -709,7 +710,7 @@ public:
             std::is_constructible< deleter_holder, D >
         >::value >::type
     >
-    explicit unique_resource_data(default_resource_t, D&& del)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit unique_resource_data(default_resource_t, D&& del)
         noexcept(detail::conjunction<
             std::is_nothrow_default_constructible< resource_holder >,
             std::is_nothrow_constructible< deleter_holder, D >
@@ -728,7 +729,7 @@ public:
             std::is_constructible< deleter_holder, D, resource_type&, bool >
         >::value >::type
     >
-    explicit unique_resource_data(R&& res, D&& del)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit unique_resource_data(R&& res, D&& del)
         noexcept(detail::conjunction<
             std::is_nothrow_constructible< resource_holder, R, D, bool >,
             std::is_nothrow_constructible< deleter_holder, D, resource_type&, bool >
@@ -753,58 +754,58 @@ public:
         return *this;
     }
 
-    resource_type& get_resource() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type& get_resource() noexcept
     {
         return resource_holder::get();
     }
 
-    resource_type const& get_resource() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type const& get_resource() const noexcept
     {
         return resource_holder::get();
     }
 
-    internal_resource_type& get_internal_resource() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type& get_internal_resource() noexcept
     {
         return resource_holder::get_internal();
     }
 
-    internal_resource_type const& get_internal_resource() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_resource_type const& get_internal_resource() const noexcept
     {
         return resource_holder::get_internal();
     }
 
-    deleter_type& get_deleter() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type& get_deleter() noexcept
     {
         return deleter_holder::get();
     }
 
-    deleter_type const& get_deleter() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type const& get_deleter() const noexcept
     {
         return deleter_holder::get();
     }
 
-    internal_deleter_type& get_internal_deleter() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_deleter_type& get_internal_deleter() noexcept
     {
         return deleter_holder::get_internal();
     }
 
-    internal_deleter_type const& get_internal_deleter() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR internal_deleter_type const& get_internal_deleter() const noexcept
     {
         return deleter_holder::get_internal();
     }
 
-    bool is_allocated() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR bool is_allocated() const noexcept
     {
         return traits_type::is_allocated(get_resource());
     }
 
-    void set_deallocated() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void set_deallocated() noexcept
     {
         get_internal_resource() = traits_type::make_default();
     }
 
     template< typename R >
-    void assign_resource(R&& res) noexcept(std::is_nothrow_assignable< internal_resource_type&, R >::value)
+    BOOST_SCOPE_CXX20_CONSTEXPR void assign_resource(R&& res) noexcept(std::is_nothrow_assignable< internal_resource_type&, R >::value)
     {
         get_internal_resource() = static_cast< R&& >(res);
     }
@@ -819,7 +820,7 @@ public:
             >
         >::value
     >
-    typename std::enable_if< Requires >::type swap(unique_resource_data& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR typename std::enable_if< Requires >::type swap(unique_resource_data& that)
         noexcept(detail::conjunction< detail::is_nothrow_swappable< internal_resource_type >, detail::is_nothrow_swappable< internal_deleter_type > >::value)
     {
         swap_impl
@@ -842,7 +843,7 @@ private:
         that.set_deallocated();
     }
 
-    unique_resource_data(unique_resource_data&& that, std::false_type) try :
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource_data(unique_resource_data&& that, std::false_type) try :
         resource_holder(static_cast< typename detail::move_or_copy_construct_ref< resource_type >::type >(that.get_resource())),
         deleter_holder(static_cast< typename detail::move_or_copy_construct_ref< deleter_type >::type >(that.get_deleter()), resource_holder::get(),
             std::is_nothrow_constructible< internal_resource_type, resource_type&& >::value && is_allocated()) // don't deallocate if the resource was copy-constructed
@@ -867,7 +868,7 @@ private:
             std::is_constructible< deleter_holder, D, resource_type&, bool >
         >::value >::type
     >
-    explicit unique_resource_data(R&& res, D&& del, bool allocated)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit unique_resource_data(R&& res, D&& del, bool allocated)
         noexcept(detail::conjunction<
             std::is_nothrow_constructible< resource_holder, R, D, bool >,
             std::is_nothrow_constructible< deleter_holder, D, resource_type&, bool >
@@ -877,7 +878,7 @@ private:
     {
     }
 
-    void assign(unique_resource_data&& that, std::true_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void assign(unique_resource_data&& that, std::true_type)
         noexcept(std::is_nothrow_assignable< internal_resource_type&, typename detail::move_or_copy_assign_ref< resource_type >::type >::value)
     {
         get_internal_resource() = static_cast< typename detail::move_or_copy_assign_ref< resource_type >::type >(that.get_resource());
@@ -886,7 +887,7 @@ private:
         that.set_deallocated();
     }
 
-    void assign(unique_resource_data&& that, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void assign(unique_resource_data&& that, std::false_type)
     {
         get_internal_deleter() = static_cast< typename detail::move_or_copy_assign_ref< deleter_type >::type >(that.get_deleter());
         get_internal_resource() = static_cast< typename detail::move_or_copy_assign_ref< resource_type >::type >(that.get_resource());
@@ -894,13 +895,13 @@ private:
         that.set_deallocated();
     }
 
-    void swap_impl(unique_resource_data& that, std::true_type, std::true_type) noexcept
+    BOOST_SCOPE_CXX20_CONSTEXPR void swap_impl(unique_resource_data& that, std::true_type, std::true_type) noexcept
     {
         boost::core::invoke_swap(get_internal_resource(), that.get_internal_resource());
         boost::core::invoke_swap(get_internal_deleter(), that.get_internal_deleter());
     }
 
-    void swap_impl(unique_resource_data& that, std::true_type, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void swap_impl(unique_resource_data& that, std::true_type, std::false_type)
     {
         boost::core::invoke_swap(get_internal_resource(), that.get_internal_resource());
         try
@@ -914,7 +915,7 @@ private:
         }
     }
 
-    void swap_impl(unique_resource_data& that, std::false_type, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void swap_impl(unique_resource_data& that, std::false_type, std::false_type)
     {
         boost::core::invoke_swap(get_internal_deleter(), that.get_internal_deleter());
         try
@@ -1065,6 +1066,18 @@ private:
 
     data m_data;
 
+    //! Invokes the deleter on the allocated resource and marks it deallocated;
+    //! kept out of line so that the inline reset/destruction fast path is a
+    //! flag check and a branch
+    BOOST_SCOPE_COLD BOOST_SCOPE_CXX20_CONSTEXPR void invoke_deleter()
+        noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        BOOST_SCOPE_DETAIL_PROFILE_INVOCATION(unique_resource_deleter,
+            boost::scope::detail::profile_action_address(m_data.get_deleter()), Deleter);
+        m_data.get_deleter()(m_data.get_resource());
+        m_data.set_deallocated();
+    }
+
 //! \endcond
 public:
     /*!
@@ -1113,7 +1126,7 @@ public:
         >::type
         //! \endcond
     >
-    unique_resource(default_resource_t res, D&& del)
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource(default_resource_t res, D&& del)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -1151,7 +1164,7 @@ public:
         >::value >::type
         //! \endcond
     >
-    explicit unique_resource(R&& res)
+    BOOST_SCOPE_CXX20_CONSTEXPR explicit unique_resource(R&& res)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -1199,7 +1212,7 @@ public:
         >::value >::type
         //! \endcond
     >
-    unique_resource(R&& res, D&& del)
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource(R&& res, D&& del)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             std::is_nothrow_constructible<
                 data,
@@ -1247,7 +1260,7 @@ public:
         typename = typename std::enable_if< Requires >::type
     >
     //! \endcond
-    unique_resource(unique_resource&& that) noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(std::is_nothrow_move_constructible< data >::value)) :
+    BOOST_SCOPE_CXX20_CONSTEXPR unique_resource(unique_resource&& that) noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(std::is_nothrow_move_constructible< data >::value)) :
         m_data(static_cast< data&& >(that.m_data))
     {
     }
@@ -1279,7 +1292,7 @@ public:
 #else
     unique_resource&
 #endif
-    operator= (unique_resource&& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR operator= (unique_resource&& that)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(std::is_nothrow_move_assignable< data >::value))
     {
         reset();
@@ -1292,7 +1305,7 @@ public:
      *
      * **Throws:** Nothing, unless invoking the deleter throws.
      */
-    ~unique_resource() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR ~unique_resource() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
     {
         reset();
     }
@@ -1302,7 +1315,7 @@ public:
      *
      * **Throws:** Nothing.
      */
-    bool allocated() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR bool allocated() const noexcept
     {
         return m_data.is_allocated();
     }
@@ -1312,7 +1325,7 @@ public:
      *
      * **Throws:** Nothing.
      */
-    resource_type const& get() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR resource_type const& get() const noexcept
     {
         return m_data.get_resource();
     }
@@ -1322,7 +1335,7 @@ public:
      *
      * **Throws:** Nothing.
      */
-    deleter_type const& get_deleter() const noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR deleter_type const& get_deleter() const noexcept
     {
         return m_data.get_deleter();
     }
@@ -1334,7 +1347,7 @@ public:
      *
      * \post `this->allocated() == false`
      */
-    void release() noexcept
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void release() noexcept
     {
         m_data.set_deallocated();
     }
@@ -1346,13 +1359,10 @@ public:
      *
      * \post `this->allocated() == false`
      */
-    void reset() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    BOOST_SCOPE_FORCEINLINE BOOST_SCOPE_CXX20_CONSTEXPR void reset() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
     {
-        if (BOOST_LIKELY(m_data.is_allocated()))
-        {
-            m_data.get_deleter()(m_data.get_resource());
-            m_data.set_deallocated();
-        }
+        if (m_data.is_allocated())
+            invoke_deleter();
     }
 
     /*!
@@ -1380,7 +1390,7 @@ public:
 #else
     void
 #endif
-    reset(R&& res)
+    BOOST_SCOPE_CXX20_CONSTEXPR reset(R&& res)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(
             detail::conjunction<
                 std::integral_constant< bool, noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())) >,
@@ -1417,7 +1427,7 @@ public:
 #else
     resource_type const&
 #endif
-    operator-> () const noexcept
+    BOOST_SCOPE_CXX20_CONSTEXPR operator-> () const noexcept
     {
         return get();
     }
@@ -1437,7 +1447,7 @@ public:
 #else
     auto
 #endif
-    operator* () const
+    BOOST_SCOPE_CXX20_CONSTEXPR operator* () const
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(detail::dereference_traits< resource_type, Requires >::is_noexcept))
     {
         return *get();
@@ -1463,7 +1473,7 @@ public:
 #else
     void
 #endif
-    swap(unique_resource& that)
+    BOOST_SCOPE_CXX20_CONSTEXPR swap(unique_resource& that)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(detail::is_nothrow_swappable< data >::value))
     {
         m_data.swap(that.m_data);
@@ -1480,7 +1490,7 @@ public:
 #else
     friend void
 #endif
-    swap(unique_resource& left, unique_resource& right)
+    BOOST_SCOPE_CXX20_CONSTEXPR swap(unique_resource& left, unique_resource& right)
         noexcept(BOOST_SCOPE_DETAIL_DOC_HIDDEN(detail::is_nothrow_swappable< data >::value))
     {
         left.swap(right);
@@ -1490,7 +1500,7 @@ public:
 private:
     //! Assigns a new resource object to the unique resource wrapper.
     template< typename R >
-    void reset_impl(R&& res, std::true_type) noexcept
+    BOOST_SCOPE_CXX20_CONSTEXPR void reset_impl(R&& res, std::true_type) noexcept
     {
         reset();
         m_data.assign_resource(static_cast< R&& >(res));
@@ -1498,7 +1508,7 @@ private:
 
     //! Assigns a new resource object to the unique resource wrapper.
     template< typename R >
-    void reset_impl(R&& res, std::false_type)
+    BOOST_SCOPE_CXX20_CONSTEXPR void reset_impl(R&& res, std::false_type)
     {
         try
         {
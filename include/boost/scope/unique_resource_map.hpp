@@ -0,0 +1,442 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/unique_resource_map.hpp
+ *
+ * This header contains definition of \c unique_resource_map, a flat
+ * open-addressing index of unique resources keyed by integer ids.
+ */
+
+#ifndef BOOST_SCOPE_UNIQUE_RESOURCE_MAP_HPP_INCLUDED_
+#define BOOST_SCOPE_UNIQUE_RESOURCE_MAP_HPP_INCLUDED_
+
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/type_traits/is_batch_deletable.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A flat map of unique resources keyed by integer ids.
+ *
+ * The map is an ownership index purpose-built for handle tables, replacing
+ * the typical `std::unordered_map< Key, unique_resource< ... > >` pattern.
+ * Keys and raw resource values are stored in two packed arrays addressed by
+ * open-addressing with linear probing, so lookup is a short scan of a dense
+ * key array instead of a pointer chase, and teardown is one linear sweep
+ * over the resource array instead of a per-node destructor walk.
+ *
+ * Resource traits are mandatory: empty slots are represented by the default
+ * resource value, so the map needs `Traits::make_default()` and
+ * `Traits::is_allocated()` to mark and recognize them without per-slot flags.
+ * Erasure uses backward shifting, so there are no tombstones and the probe
+ * sequences stay short regardless of the erase history.
+ *
+ * If the deleter supports the batch protocol (is invocable as
+ * `del(res_array, count)`), \c reset_all() compacts the allocated resources
+ * and releases them with a single deleter invocation.
+ *
+ * \tparam Key The key type, an integral id.
+ * \tparam Resource The resource type.
+ * \tparam Deleter The deleter type, stored once for the whole map.
+ * \tparam Traits Resource traits providing `make_default()` and `is_allocated()`.
+ */
+template< typename Key, typename Resource, typename Deleter, typename Traits >
+class unique_resource_map
+{
+public:
+    //! Key type
+    typedef Key key_type;
+    //! Resource type
+    typedef Resource resource_type;
+    //! Deleter type
+    typedef Deleter deleter_type;
+    //! Resource traits
+    typedef Traits traits_type;
+    //! Size type
+    typedef std::size_t size_type;
+
+private:
+    static_assert(std::is_integral< Key >::value, "boost::scope::unique_resource_map requires an integral key type");
+    static_assert(detail::has_custom_default< Resource, Traits >::value,
+        "boost::scope::unique_resource_map requires Traits::make_default()");
+    static_assert(detail::has_deallocated_state< Resource, Traits >::value,
+        "boost::scope::unique_resource_map requires Traits::is_allocated()");
+    static_assert(std::is_nothrow_move_constructible< Resource >::value || std::is_nothrow_copy_constructible< Resource >::value,
+        "boost::scope::unique_resource_map requires Resource to be nothrow move or copy constructible");
+    static_assert(noexcept(Traits::make_default()), "boost::scope::unique_resource_map requires noexcept Traits::make_default()");
+
+private:
+    key_type* m_keys;
+    resource_type* m_resources;
+    size_type m_size;
+    //! Slot count, always zero or a power of two
+    size_type m_capacity;
+    deleter_type m_deleter;
+
+public:
+    /*!
+     * \brief Constructs an empty map.
+     *
+     * **Throws:** Nothing, unless the deleter constructor throws.
+     */
+    unique_resource_map() noexcept(std::is_nothrow_default_constructible< Deleter >::value) :
+        m_keys(nullptr),
+        m_resources(nullptr),
+        m_size(0u),
+        m_capacity(0u),
+        m_deleter()
+    {
+    }
+
+    /*!
+     * \brief Constructs an empty map with the given deleter.
+     *
+     * **Throws:** Nothing, unless the deleter constructor throws.
+     */
+    explicit unique_resource_map(deleter_type del) noexcept(std::is_nothrow_move_constructible< Deleter >::value) :
+        m_keys(nullptr),
+        m_resources(nullptr),
+        m_size(0u),
+        m_capacity(0u),
+        m_deleter(static_cast< deleter_type&& >(del))
+    {
+    }
+
+    //! Transfers the contents of \a that
+    unique_resource_map(unique_resource_map&& that) noexcept(std::is_nothrow_move_constructible< Deleter >::value) :
+        m_keys(that.m_keys),
+        m_resources(that.m_resources),
+        m_size(that.m_size),
+        m_capacity(that.m_capacity),
+        m_deleter(static_cast< deleter_type&& >(that.m_deleter))
+    {
+        that.m_keys = nullptr;
+        that.m_resources = nullptr;
+        that.m_size = 0u;
+        that.m_capacity = 0u;
+    }
+
+    unique_resource_map(unique_resource_map const&) = delete;
+    unique_resource_map& operator= (unique_resource_map&&) = delete;
+    unique_resource_map& operator= (unique_resource_map const&) = delete;
+
+    /*!
+     * \brief Releases all owned resources and frees the storage.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    ~unique_resource_map() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        reset_all();
+        destroy_slots();
+        ::operator delete(static_cast< void* >(m_keys));
+        ::operator delete(static_cast< void* >(m_resources));
+    }
+
+    /*!
+     * \brief Inserts a resource under the given key and takes ownership of it.
+     *
+     * If a resource is already mapped to the key, the deleter is invoked on
+     * the previous resource and the new one takes its slot.
+     *
+     * **Throws:** `std::bad_alloc` on allocation failure, in which case the
+     *             deleter is invoked on \a res before the exception propagates.
+     */
+    void insert(key_type key, resource_type res)
+    {
+        BOOST_ASSERT(Traits::is_allocated(res));
+
+        // Keep the load factor at or below 3/4
+        if (BOOST_UNLIKELY((m_size + 1u) * 4u > m_capacity * 3u))
+        {
+            try
+            {
+                grow();
+            }
+            catch (...)
+            {
+                m_deleter(res);
+                throw;
+            }
+        }
+
+        size_type pos = bucket_of(key);
+        while (!!Traits::is_allocated(m_resources[pos]))
+        {
+            if (m_keys[pos] == key)
+            {
+                // Replace the previously mapped resource
+                m_deleter(m_resources[pos]);
+                m_resources[pos] = static_cast< resource_type&& >(res);
+                return;
+            }
+
+            pos = (pos + 1u) & (m_capacity - 1u);
+        }
+
+        m_keys[pos] = key;
+        m_resources[pos] = static_cast< resource_type&& >(res);
+        ++m_size;
+    }
+
+    /*!
+     * \brief Looks up the resource mapped to the given key.
+     *
+     * **Throws:** Nothing.
+     *
+     * \returns A pointer to the resource value, or \c nullptr if the key is not present.
+     */
+    resource_type const* find(key_type key) const noexcept
+    {
+        const size_type pos = find_slot(key);
+        return pos != m_capacity ? m_resources + pos : nullptr;
+    }
+
+    /*!
+     * \brief Relinquishes ownership of the resource mapped to the given key without releasing it.
+     *
+     * **Requires:** The key is present in the map.
+     *
+     * **Throws:** Nothing.
+     *
+     * \returns The resource value that was mapped to the key.
+     */
+    resource_type release(key_type key) noexcept
+    {
+        const size_type pos = find_slot(key);
+        BOOST_ASSERT_MSG(pos != m_capacity, "boost::scope::unique_resource_map: release() called for a key that is not present");
+
+        resource_type res(static_cast< resource_type&& >(m_resources[pos]));
+        remove_slot(pos);
+        return res;
+    }
+
+    /*!
+     * \brief Invokes the deleter on the resource mapped to the given key and removes the mapping.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     *
+     * \returns \c true if the key was present, otherwise \c false.
+     */
+    bool reset(key_type key) noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        const size_type pos = find_slot(key);
+        if (pos == m_capacity)
+            return false;
+
+        m_deleter(m_resources[pos]);
+        remove_slot(pos);
+        return true;
+    }
+
+    /*!
+     * \brief Invokes the deleter on every owned resource and empties the map.
+     *
+     * Runs as one linear sweep over the packed resource array. If the deleter
+     * supports the batch protocol (is invocable as `del(res_array, count)`),
+     * the allocated resources are compacted and released with a single
+     * deleter invocation.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    void reset_all() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        reset_all_impl(std::integral_constant< bool, detail::is_batch_deletable< deleter_type, resource_type >::value >());
+        m_size = 0u;
+    }
+
+    //! Returns the number of resources in the map
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    //! Returns the number of slots in the table
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    //! Returns \c true if the map holds no resources
+    bool empty() const noexcept
+    {
+        return m_size == 0u;
+    }
+
+    //! Returns the deleter shared by all resources in the map
+    deleter_type const& get_deleter() const noexcept
+    {
+        return m_deleter;
+    }
+
+private:
+    //! Returns the ideal slot index for the key
+    size_type bucket_of(key_type key) const noexcept
+    {
+        // Fibonacci hashing spreads sequentially allocated ids across the
+        // table; the high bits are folded down since the table mask selects
+        // the low bits.
+        std::uint64_t h = static_cast< std::uint64_t >(key) * UINT64_C(0x9E3779B97F4A7C15);
+        h ^= h >> 32u;
+        return static_cast< size_type >(h) & (m_capacity - 1u);
+    }
+
+    //! Finds the slot holding the key; returns \c m_capacity if the key is not present
+    size_type find_slot(key_type key) const noexcept
+    {
+        if (BOOST_UNLIKELY(m_capacity == 0u))
+            return 0u;
+
+        size_type pos = bucket_of(key);
+        while (!!Traits::is_allocated(m_resources[pos]))
+        {
+            if (m_keys[pos] == key)
+                return pos;
+
+            pos = (pos + 1u) & (m_capacity - 1u);
+        }
+
+        return m_capacity;
+    }
+
+    //! Empties the slot and backward-shifts the following probe run to keep lookups correct
+    void remove_slot(size_type pos) noexcept
+    {
+        size_type hole = pos;
+        size_type i = pos;
+        while (true)
+        {
+            i = (i + 1u) & (m_capacity - 1u);
+            if (!Traits::is_allocated(m_resources[i]))
+                break;
+
+            // The element can fill the hole if the hole lies on its probe
+            // path, i.e. between its ideal slot and its current slot
+            const size_type ideal = bucket_of(m_keys[i]);
+            if (((i - ideal) & (m_capacity - 1u)) >= ((i - hole) & (m_capacity - 1u)))
+            {
+                m_keys[hole] = m_keys[i];
+                m_resources[hole] = static_cast< resource_type&& >(m_resources[i]);
+                hole = i;
+            }
+        }
+
+        m_resources[hole] = Traits::make_default();
+        --m_size;
+    }
+
+    //! Releases all owned resources one deleter invocation at a time
+    void reset_all_impl(std::false_type) noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        for (size_type i = 0u, n = m_capacity; i < n; ++i)
+        {
+            if (!!Traits::is_allocated(m_resources[i]))
+            {
+                m_deleter(m_resources[i]);
+                m_resources[i] = Traits::make_default();
+            }
+        }
+    }
+
+    //! Compacts the owned resources and releases them with one batch deleter invocation
+    void reset_all_impl(std::true_type)
+        noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type const* >(), std::declval< std::size_t >())))
+    {
+        size_type allocated_count = 0u;
+        for (size_type i = 0u, n = m_capacity; i < n; ++i)
+        {
+            if (!!Traits::is_allocated(m_resources[i]))
+            {
+                if (i != allocated_count)
+                {
+                    m_resources[allocated_count] = static_cast< resource_type&& >(m_resources[i]);
+                    m_resources[i] = Traits::make_default();
+                }
+                ++allocated_count;
+            }
+        }
+
+        if (BOOST_LIKELY(allocated_count > 0u))
+            m_deleter(static_cast< resource_type const* >(m_resources), static_cast< std::size_t >(allocated_count));
+
+        for (size_type i = 0u, n = allocated_count; i < n; ++i)
+            m_resources[i] = Traits::make_default();
+    }
+
+    //! Doubles the table size and reinserts the elements
+    void grow()
+    {
+        const size_type new_capacity = m_capacity > 0u ? m_capacity * 2u : 16u;
+        key_type* const new_keys = static_cast< key_type* >(::operator new(new_capacity * sizeof(key_type)));
+        resource_type* new_resources;
+        try
+        {
+            new_resources = static_cast< resource_type* >(::operator new(new_capacity * sizeof(resource_type)));
+        }
+        catch (...)
+        {
+            ::operator delete(static_cast< void* >(new_keys));
+            throw;
+        }
+
+        for (size_type i = 0u; i < new_capacity; ++i)
+            new (static_cast< void* >(new_resources + i)) resource_type(Traits::make_default());
+
+        key_type* const old_keys = m_keys;
+        resource_type* const old_resources = m_resources;
+        const size_type old_capacity = m_capacity;
+
+        m_keys = new_keys;
+        m_resources = new_resources;
+        m_capacity = new_capacity;
+
+        for (size_type i = 0u; i < old_capacity; ++i)
+        {
+            if (!!Traits::is_allocated(old_resources[i]))
+            {
+                size_type pos = bucket_of(old_keys[i]);
+                while (!!Traits::is_allocated(m_resources[pos]))
+                    pos = (pos + 1u) & (new_capacity - 1u);
+
+                m_keys[pos] = old_keys[i];
+                m_resources[pos] = static_cast< resource_type&& >(old_resources[i]);
+            }
+            old_resources[i].~resource_type();
+        }
+
+        ::operator delete(static_cast< void* >(old_keys));
+        ::operator delete(static_cast< void* >(old_resources));
+    }
+
+    //! Destroys all slot values; the table becomes unusable until the storage is freed
+    void destroy_slots() noexcept
+    {
+        for (size_type i = 0u, n = m_capacity; i < n; ++i)
+            m_resources[i].~resource_type();
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_UNIQUE_RESOURCE_MAP_HPP_INCLUDED_
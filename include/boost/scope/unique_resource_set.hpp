@@ -0,0 +1,384 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/unique_resource_set.hpp
+ *
+ * This header contains definition of \c unique_resource_set, a contiguous
+ * container of unique resources with batched teardown.
+ */
+
+#ifndef BOOST_SCOPE_UNIQUE_RESOURCE_SET_HPP_INCLUDED_
+#define BOOST_SCOPE_UNIQUE_RESOURCE_SET_HPP_INCLUDED_
+
+#include <new>
+#include <cstddef>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/type_traits/is_batch_deletable.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+/*!
+ * \brief A contiguous set of unique resources with a shared deleter.
+ *
+ * Unlike a vector of \c unique_resource objects, which scatters resource
+ * values, allocation flags and deleter copies across memory, the container
+ * stores raw resource values in one packed array and the deleter exactly
+ * once. Teardown is a single tight loop over the array, which is
+ * dramatically more cache-friendly for large resource tables (e.g. tens of
+ * thousands of file descriptors).
+ *
+ * Resource traits are mandatory: unallocated slots are represented by the
+ * default resource value, so the container needs `Traits::make_default()`
+ * and `Traits::is_allocated()` to mark and recognize empty slots without
+ * per-element flags.
+ *
+ * Inserting returns a stable index; \c release() and \c reset() by index are
+ * O(1), with released slots recycled through an internal free list. Element
+ * addresses are invalidated by insertion; indices are not.
+ *
+ * \tparam Resource The resource type.
+ * \tparam Deleter The deleter type, stored once for the whole container.
+ * \tparam Traits Resource traits providing `make_default()` and `is_allocated()`.
+ */
+template< typename Resource, typename Deleter, typename Traits >
+class unique_resource_set
+{
+public:
+    //! Resource type
+    typedef Resource resource_type;
+    //! Deleter type
+    typedef Deleter deleter_type;
+    //! Resource traits
+    typedef Traits traits_type;
+    //! Index type
+    typedef std::size_t size_type;
+
+private:
+    static_assert(detail::has_custom_default< Resource, Traits >::value,
+        "boost::scope::unique_resource_set requires Traits::make_default()");
+    static_assert(detail::has_deallocated_state< Resource, Traits >::value,
+        "boost::scope::unique_resource_set requires Traits::is_allocated()");
+    static_assert(std::is_nothrow_move_constructible< Resource >::value || std::is_nothrow_copy_constructible< Resource >::value,
+        "boost::scope::unique_resource_set requires Resource to be nothrow move or copy constructible");
+    static_assert(noexcept(Traits::make_default()), "boost::scope::unique_resource_set requires noexcept Traits::make_default()");
+
+private:
+    resource_type* m_resources;
+    size_type m_size;
+    size_type m_capacity;
+    size_type* m_free_indices;
+    size_type m_free_count;
+    size_type m_free_capacity;
+    deleter_type m_deleter;
+
+public:
+    /*!
+     * \brief Constructs an empty set.
+     *
+     * **Throws:** Nothing, unless the deleter constructor throws.
+     */
+    unique_resource_set() noexcept(std::is_nothrow_default_constructible< Deleter >::value) :
+        m_resources(nullptr),
+        m_size(0u),
+        m_capacity(0u),
+        m_free_indices(nullptr),
+        m_free_count(0u),
+        m_free_capacity(0u),
+        m_deleter()
+    {
+    }
+
+    /*!
+     * \brief Constructs an empty set with the given deleter.
+     *
+     * **Throws:** Nothing, unless the deleter constructor throws.
+     */
+    explicit unique_resource_set(deleter_type del) noexcept(std::is_nothrow_move_constructible< Deleter >::value) :
+        m_resources(nullptr),
+        m_size(0u),
+        m_capacity(0u),
+        m_free_indices(nullptr),
+        m_free_count(0u),
+        m_free_capacity(0u),
+        m_deleter(static_cast< deleter_type&& >(del))
+    {
+    }
+
+    //! Transfers the contents of \a that
+    unique_resource_set(unique_resource_set&& that) noexcept(std::is_nothrow_move_constructible< Deleter >::value) :
+        m_resources(that.m_resources),
+        m_size(that.m_size),
+        m_capacity(that.m_capacity),
+        m_free_indices(that.m_free_indices),
+        m_free_count(that.m_free_count),
+        m_free_capacity(that.m_free_capacity),
+        m_deleter(static_cast< deleter_type&& >(that.m_deleter))
+    {
+        that.m_resources = nullptr;
+        that.m_size = 0u;
+        that.m_capacity = 0u;
+        that.m_free_indices = nullptr;
+        that.m_free_count = 0u;
+        that.m_free_capacity = 0u;
+    }
+
+    unique_resource_set(unique_resource_set const&) = delete;
+    unique_resource_set& operator= (unique_resource_set&&) = delete;
+    unique_resource_set& operator= (unique_resource_set const&) = delete;
+
+    /*!
+     * \brief Releases all allocated resources and frees the storage.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    ~unique_resource_set() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        reset_all();
+        ::operator delete(static_cast< void* >(m_resources));
+        ::operator delete(static_cast< void* >(m_free_indices));
+    }
+
+    /*!
+     * \brief Inserts a resource into the set and takes ownership of it.
+     *
+     * Released slots are recycled first; otherwise the resource is appended,
+     * growing the storage geometrically when at capacity.
+     *
+     * **Throws:** `std::bad_alloc` on allocation failure, in which case the
+     *             deleter is invoked on \a res before the exception propagates.
+     *
+     * \returns The index of the inserted resource, stable until \c reset_all().
+     */
+    size_type insert(resource_type res)
+    {
+        BOOST_ASSERT(Traits::is_allocated(res));
+
+        if (m_free_count > 0u)
+        {
+            const size_type index = m_free_indices[--m_free_count];
+            m_resources[index] = static_cast< resource_type&& >(res);
+            return index;
+        }
+
+        if (BOOST_UNLIKELY(m_size == m_capacity))
+        {
+            try
+            {
+                grow();
+            }
+            catch (...)
+            {
+                m_deleter(res);
+                throw;
+            }
+        }
+
+        const size_type index = m_size;
+        new (static_cast< void* >(m_resources + index)) resource_type(static_cast< resource_type&& >(res));
+        ++m_size;
+        return index;
+    }
+
+    /*!
+     * \brief Returns the resource at the given index.
+     *
+     * **Throws:** Nothing.
+     */
+    resource_type const& operator[] (size_type index) const noexcept
+    {
+        BOOST_ASSERT(index < m_size);
+        return m_resources[index];
+    }
+
+    /*!
+     * \brief Returns \c true if the slot at the given index holds an allocated resource.
+     *
+     * **Throws:** Nothing.
+     */
+    bool allocated(size_type index) const noexcept
+    {
+        BOOST_ASSERT(index < m_size);
+        return !!Traits::is_allocated(m_resources[index]);
+    }
+
+    /*!
+     * \brief Relinquishes ownership of the resource at the given index without releasing it.
+     *
+     * The slot becomes empty and is recycled by subsequent insertions.
+     *
+     * **Throws:** Nothing. If free list storage cannot be grown, the slot is
+     *             not recycled until \c reset_all(), but ownership is still
+     *             relinquished.
+     *
+     * \returns The resource value that was stored at the index.
+     */
+    resource_type release(size_type index) noexcept
+    {
+        BOOST_ASSERT(index < m_size);
+        BOOST_ASSERT(Traits::is_allocated(m_resources[index]));
+
+        resource_type res(static_cast< resource_type&& >(m_resources[index]));
+        m_resources[index] = Traits::make_default();
+        recycle(index);
+        return res;
+    }
+
+    /*!
+     * \brief Invokes the deleter on the resource at the given index and empties the slot.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    void reset(size_type index) noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        BOOST_ASSERT(index < m_size);
+        BOOST_ASSERT(Traits::is_allocated(m_resources[index]));
+
+        m_deleter(m_resources[index]);
+        m_resources[index] = Traits::make_default();
+        recycle(index);
+    }
+
+    /*!
+     * \brief Invokes the deleter on every allocated resource and empties the set.
+     *
+     * Runs as one pass over the packed resource array. If the deleter
+     * supports the batch protocol (is invocable as `del(res_array, count)`),
+     * the allocated resources are compacted and released with a single
+     * deleter invocation. Indices obtained from previous insertions are
+     * invalidated.
+     *
+     * **Throws:** Nothing, unless invoking the deleter throws.
+     */
+    void reset_all() noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        reset_all_impl(std::integral_constant< bool, detail::is_batch_deletable< deleter_type, resource_type >::value >());
+        m_size = 0u;
+        m_free_count = 0u;
+    }
+
+    //! Returns the number of slots in the set, including empty ones
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    //! Returns the number of slots the set can hold without reallocation
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    //! Returns \c true if the set holds no slots
+    bool empty() const noexcept
+    {
+        return m_size == 0u;
+    }
+
+    //! Returns the deleter shared by all resources in the set
+    deleter_type const& get_deleter() const noexcept
+    {
+        return m_deleter;
+    }
+
+    //! Returns a pointer to the packed resource array
+    resource_type const* data() const noexcept
+    {
+        return m_resources;
+    }
+
+private:
+    //! Releases all allocated resources one deleter invocation at a time
+    void reset_all_impl(std::false_type) noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type& >())))
+    {
+        for (size_type i = 0u, n = m_size; i < n; ++i)
+        {
+            if (BOOST_LIKELY(!!Traits::is_allocated(m_resources[i])))
+                m_deleter(m_resources[i]);
+            m_resources[i].~resource_type();
+        }
+    }
+
+    //! Compacts the allocated resources and releases them with one batch deleter invocation
+    void reset_all_impl(std::true_type)
+        noexcept(noexcept(std::declval< deleter_type& >()(std::declval< resource_type const* >(), std::declval< std::size_t >())))
+    {
+        size_type allocated_count = 0u;
+        for (size_type i = 0u, n = m_size; i < n; ++i)
+        {
+            if (BOOST_LIKELY(!!Traits::is_allocated(m_resources[i])))
+            {
+                if (i != allocated_count)
+                    m_resources[allocated_count] = static_cast< resource_type&& >(m_resources[i]);
+                ++allocated_count;
+            }
+        }
+
+        if (BOOST_LIKELY(allocated_count > 0u))
+            m_deleter(static_cast< resource_type const* >(m_resources), static_cast< std::size_t >(allocated_count));
+
+        for (size_type i = 0u, n = m_size; i < n; ++i)
+            m_resources[i].~resource_type();
+    }
+
+    //! Grows the resource array geometrically
+    void grow()
+    {
+        const size_type new_capacity = m_capacity > 0u ? m_capacity * 2u : 16u;
+        resource_type* const new_resources = static_cast< resource_type* >(
+            ::operator new(new_capacity * sizeof(resource_type)));
+
+        for (size_type i = 0u, n = m_size; i < n; ++i)
+        {
+            new (static_cast< void* >(new_resources + i)) resource_type(static_cast< resource_type&& >(m_resources[i]));
+            m_resources[i].~resource_type();
+        }
+
+        ::operator delete(static_cast< void* >(m_resources));
+        m_resources = new_resources;
+        m_capacity = new_capacity;
+    }
+
+    //! Adds the index to the free list; on allocation failure the slot is simply not recycled
+    void recycle(size_type index) noexcept
+    {
+        if (BOOST_UNLIKELY(m_free_count == m_free_capacity))
+        {
+            const size_type new_capacity = m_free_capacity > 0u ? m_free_capacity * 2u : 16u;
+            size_type* const new_indices = static_cast< size_type* >(
+                ::operator new(new_capacity * sizeof(size_type), std::nothrow));
+            if (BOOST_UNLIKELY(new_indices == nullptr))
+                return;
+
+            for (size_type i = 0u, n = m_free_count; i < n; ++i)
+                new_indices[i] = m_free_indices[i];
+
+            ::operator delete(static_cast< void* >(m_free_indices));
+            m_free_indices = new_indices;
+            m_free_capacity = new_capacity;
+        }
+
+        m_free_indices[m_free_count++] = index;
+    }
+};
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_UNIQUE_RESOURCE_SET_HPP_INCLUDED_
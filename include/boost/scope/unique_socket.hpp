@@ -0,0 +1,118 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/unique_socket.hpp
+ *
+ * This header contains definition of \c unique_socket type for POSIX
+ * sockets, with optional deferred closing of lingering sockets.
+ * The header is empty on Windows.
+ */
+
+#ifndef BOOST_SCOPE_UNIQUE_SOCKET_HPP_INCLUDED_
+#define BOOST_SCOPE_UNIQUE_SOCKET_HPP_INCLUDED_
+
+#include <boost/scope/detail/config.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
+#endif
+#include <atomic>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/fd_resource_traits.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+//! Deferred socket close handler type
+typedef void (*deferred_socket_close_handler_t)(int fd);
+
+namespace detail {
+
+//! Storage for the deferred socket close handler. The template is a means to
+//! define the static data member in the header without ODR violations.
+template< typename = void >
+struct deferred_socket_close_handler_storage
+{
+    static std::atomic< deferred_socket_close_handler_t > handler;
+};
+
+template< typename Void >
+std::atomic< deferred_socket_close_handler_t > deferred_socket_close_handler_storage< Void >::handler{ nullptr };
+
+} // namespace detail
+
+/*!
+ * \brief Sets the process-wide deferred socket close handler.
+ *
+ * When a handler is set, \c socket_deleter hands sockets that still have
+ * unsent data in the kernel send queue to the handler instead of closing
+ * them inline. This keeps the destructing thread from blocking in `close(2)`
+ * for the `SO_LINGER` timeout; the handler is expected to transfer the
+ * descriptor to a low-priority thread that performs the close. The handler
+ * takes ownership of the descriptor and must eventually close it.
+ *
+ * Sockets with an empty send queue are always closed inline. The unsent
+ * data check is currently only implemented on Linux; on other systems the
+ * handler is never invoked.
+ *
+ * \param handler The new handler, or \c nullptr to restore inline closing.
+ *
+ * \returns The previously set handler.
+ *
+ * **Throws:** Nothing.
+ */
+inline deferred_socket_close_handler_t set_deferred_socket_close_handler(deferred_socket_close_handler_t handler) noexcept
+{
+    return detail::deferred_socket_close_handler_storage<>::handler.exchange(handler, std::memory_order_acq_rel);
+}
+
+//! POSIX socket deleter
+struct socket_deleter
+{
+    typedef void result_type;
+
+    //! Closes the socket, deferring lingering closes to the registered handler
+    result_type operator() (int fd) const noexcept
+    {
+#if defined(__linux__)
+        deferred_socket_close_handler_t handler =
+            detail::deferred_socket_close_handler_storage<>::handler.load(std::memory_order_acquire);
+        if (BOOST_UNLIKELY(handler != nullptr))
+        {
+            int pending = 0;
+            if (::ioctl(fd, SIOCOUTQ, &pending) == 0 && pending > 0)
+            {
+                handler(fd);
+                return;
+            }
+        }
+#endif // defined(__linux__)
+        ::close(fd);
+    }
+};
+
+//! Unique POSIX socket resource
+typedef unique_resource< int, socket_deleter, fd_resource_traits > unique_socket;
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // !defined(BOOST_WINDOWS)
+
+#endif // BOOST_SCOPE_UNIQUE_SOCKET_HPP_INCLUDED_
@@ -0,0 +1,226 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file scope/watchdog_deleter.hpp
+ *
+ * This header contains definition of \c watchdog_deleter, a sampling
+ * wrapper that detects pathologically slow deleter invocations.
+ */
+
+#ifndef BOOST_SCOPE_WATCHDOG_DELETER_HPP_INCLUDED_
+#define BOOST_SCOPE_WATCHDOG_DELETER_HPP_INCLUDED_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <boost/config.hpp>
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace scope {
+
+//! Slow deleter handler type. The argument is the sampled deleter duration, in nanoseconds.
+typedef void (*slow_deleter_handler_t)(std::uint64_t duration_ns);
+
+//! Number of buckets in the slow deleter latency histogram
+BOOST_CONSTEXPR_OR_CONST unsigned int slow_deleter_histogram_bucket_count = 32u;
+
+namespace detail {
+
+//! Global slow deleter watchdog state
+template< typename = void >
+struct watchdog_state
+{
+    //! Sampling counter, shared by all \c watchdog_deleter instantiations
+    static std::atomic< std::uint64_t > sample_counter;
+    //! Latency histogram; bucket N counts samples with durations in [2^N, 2^(N+1)) nanoseconds
+    static std::atomic< std::uint64_t > histogram[slow_deleter_histogram_bucket_count];
+    //! Threshold, in nanoseconds, above which the handler is invoked
+    static std::atomic< std::uint64_t > threshold_ns;
+    //! User-registered slow deleter handler
+    static std::atomic< slow_deleter_handler_t > handler;
+};
+
+template< typename Void >
+std::atomic< std::uint64_t > watchdog_state< Void >::sample_counter{ 0u };
+template< typename Void >
+std::atomic< std::uint64_t > watchdog_state< Void >::histogram[slow_deleter_histogram_bucket_count] = {};
+template< typename Void >
+std::atomic< std::uint64_t > watchdog_state< Void >::threshold_ns{ static_cast< std::uint64_t >(-1) };
+template< typename Void >
+std::atomic< slow_deleter_handler_t > watchdog_state< Void >::handler{ nullptr };
+
+//! Returns the histogram bucket index for the given duration
+inline unsigned int watchdog_histogram_bucket(std::uint64_t duration_ns) noexcept
+{
+    unsigned int bucket = 0u;
+    while (duration_ns > 1u && bucket < (slow_deleter_histogram_bucket_count - 1u))
+    {
+        duration_ns >>= 1u;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+//! Records a sampled deleter duration and fires the handler if it crosses the threshold
+inline void watchdog_record_sample(std::uint64_t duration_ns) noexcept
+{
+    watchdog_state<>::histogram[watchdog_histogram_bucket(duration_ns)]
+        .fetch_add(1u, std::memory_order_relaxed);
+
+    if (BOOST_UNLIKELY(duration_ns >= watchdog_state<>::threshold_ns.load(std::memory_order_relaxed)))
+    {
+        slow_deleter_handler_t const handler = watchdog_state<>::handler.load(std::memory_order_acquire);
+        if (handler)
+            handler(duration_ns);
+    }
+}
+
+} // namespace detail
+
+/*!
+ * \brief Sets the slow deleter handler and latency threshold.
+ *
+ * The handler is invoked from within a sampled deleter call, on the thread
+ * releasing the resource, whenever the sampled duration is greater or equal
+ * to \a threshold_ns nanoseconds. The handler must be async-friendly: it may
+ * run during stack unwinding and must not throw.
+ *
+ * Passing a null \a handler disables the threshold check.
+ *
+ * **Throws:** Nothing.
+ *
+ * \returns The previously set handler, or `nullptr` if none was set.
+ */
+inline slow_deleter_handler_t set_slow_deleter_handler(slow_deleter_handler_t handler, std::uint64_t threshold_ns) noexcept
+{
+    detail::watchdog_state<>::threshold_ns.store(handler ? threshold_ns : static_cast< std::uint64_t >(-1), std::memory_order_relaxed);
+    return detail::watchdog_state<>::handler.exchange(handler, std::memory_order_acq_rel);
+}
+
+/*!
+ * \brief Copies the slow deleter latency histogram into \a buckets.
+ *
+ * Bucket N counts samples with durations in [2^N, 2^(N+1)) nanoseconds;
+ * the last bucket absorbs all longer durations. The copy is not an atomic
+ * snapshot of the whole histogram.
+ *
+ * **Throws:** Nothing.
+ */
+inline void slow_deleter_histogram(std::uint64_t (&buckets)[slow_deleter_histogram_bucket_count]) noexcept
+{
+    for (unsigned int i = 0u; i < slow_deleter_histogram_bucket_count; ++i)
+    {
+        buckets[i] = detail::watchdog_state<>::histogram[i].load(std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * \brief A deleter wrapper that samples invocation latencies.
+ *
+ * One in \c SamplingInterval invocations, across all wrapped deleters in the
+ * process, is timed with a monotonic clock; the sampled duration is recorded
+ * in a per-process log2 latency histogram and, when it crosses the threshold
+ * registered with \c set_slow_deleter_handler, the handler is invoked. The
+ * remaining invocations only pay for one relaxed atomic increment, so the
+ * wrapper is suitable for always-on production use — e.g. to catch
+ * `close(2)` blocking for seconds on a hung network mount.
+ *
+ * \tparam Deleter The wrapped deleter type.
+ * \tparam SamplingInterval Sampling interval; must be a power of 2.
+ */
+template< typename Deleter, unsigned int SamplingInterval = 64u >
+class watchdog_deleter
+{
+public:
+    //! Deleter result type
+    typedef void result_type;
+
+private:
+    static_assert(SamplingInterval > 0u && (SamplingInterval & (SamplingInterval - 1u)) == 0u,
+        "SamplingInterval must be a power of 2");
+
+    Deleter m_deleter;
+
+public:
+    /*!
+     * \brief Constructs the wrapped deleter.
+     *
+     * **Throws:** Nothing, unless the wrapped deleter constructor throws.
+     */
+    watchdog_deleter() noexcept(std::is_nothrow_default_constructible< Deleter >::value) :
+        m_deleter()
+    {
+    }
+
+    /*!
+     * \brief Constructs the wrapper with the given deleter.
+     *
+     * **Throws:** Nothing, unless the wrapped deleter constructor throws.
+     */
+    explicit watchdog_deleter(Deleter del) noexcept(std::is_nothrow_move_constructible< Deleter >::value) :
+        m_deleter(static_cast< Deleter&& >(del))
+    {
+    }
+
+    /*!
+     * \brief Invokes the wrapped deleter, timing one in \c SamplingInterval invocations.
+     *
+     * **Throws:** Nothing, unless the wrapped deleter throws.
+     */
+    template< typename Resource >
+    result_type operator() (Resource&& res) const
+        noexcept(noexcept(std::declval< Deleter const& >()(std::declval< Resource&& >())))
+    {
+        const std::uint64_t count = detail::watchdog_state<>::sample_counter.fetch_add(1u, std::memory_order_relaxed);
+        if (BOOST_LIKELY((count & (SamplingInterval - 1u)) != 0u))
+        {
+            m_deleter(static_cast< Resource&& >(res));
+            return;
+        }
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        m_deleter(static_cast< Resource&& >(res));
+        const std::uint64_t duration_ns = static_cast< std::uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(
+            std::chrono::steady_clock::now() - start).count());
+
+        detail::watchdog_record_sample(duration_ns);
+    }
+
+    //! Returns the wrapped deleter
+    Deleter const& get_deleter() const noexcept
+    {
+        return m_deleter;
+    }
+};
+
+/*!
+ * \brief Creates a \c watchdog_deleter wrapping the given deleter.
+ *
+ * **Throws:** Nothing, unless the deleter move constructor throws.
+ */
+template< unsigned int SamplingInterval = 64u, typename Deleter >
+inline watchdog_deleter< typename std::decay< Deleter >::type, SamplingInterval > make_watchdog_deleter(Deleter&& del)
+    noexcept(std::is_nothrow_constructible< typename std::decay< Deleter >::type, Deleter >::value)
+{
+    return watchdog_deleter< typename std::decay< Deleter >::type, SamplingInterval >(static_cast< Deleter&& >(del));
+}
+
+} // namespace scope
+} // namespace boost
+
+#include <boost/scope/detail/footer.hpp>
+
+#endif // BOOST_SCOPE_WATCHDOG_DELETER_HPP_INCLUDED_
@@ -0,0 +1,59 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file module/boost_scope.cppm
+ *
+ * This file contains the C++20 module interface unit for Boost.Scope.
+ * Importing \c boost.scope replaces textual inclusion of the library headers.
+ */
+
+module;
+
+#include <boost/scope/scope_exit.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/scope_success.hpp>
+#include <boost/scope/scope_final.hpp>
+#include <boost/scope/exception_checker.hpp>
+#include <boost/scope/error_code_checker.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/fd_deleter.hpp>
+#include <boost/scope/fd_resource_traits.hpp>
+#include <boost/scope/unique_fd.hpp>
+
+export module boost.scope;
+
+export namespace boost {
+namespace scope {
+
+// Scope guards
+using boost::scope::scope_exit;
+using boost::scope::scope_fail;
+using boost::scope::scope_success;
+using boost::scope::scope_final;
+using boost::scope::make_scope_exit;
+using boost::scope::make_scope_fail;
+using boost::scope::make_scope_success;
+
+// Condition function objects
+using boost::scope::always_true;
+using boost::scope::exception_checker;
+using boost::scope::check_exception;
+using boost::scope::error_code_checker;
+using boost::scope::check_error_code;
+
+// Unique resource wrappers
+using boost::scope::default_resource_t;
+using boost::scope::default_resource;
+using boost::scope::unique_resource;
+using boost::scope::make_unique_resource_checked;
+using boost::scope::fd_deleter;
+using boost::scope::fd_resource_traits;
+using boost::scope::unique_fd;
+
+} // namespace scope
+} // namespace boost
@@ -0,0 +1,24 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_fd.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains explicit instantiation definitions for the
+ *         \c unique_resource specializations declared extern in the headers.
+ */
+
+#include <boost/scope/unique_fd.hpp>
+
+namespace boost {
+namespace scope {
+
+template class unique_resource< int, fd_deleter, fd_resource_traits >;
+
+} // namespace scope
+} // namespace boost
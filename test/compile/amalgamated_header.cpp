@@ -0,0 +1,50 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   amalgamated_header.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests that the generated amalgamated header compiles and
+ *         provides the components it inlines. The header only exists when
+ *         generated (BOOST_SCOPE_GENERATE_AMALGAMATED_HEADER), so the test
+ *         degrades to a no-op when it is not on the include path.
+ */
+
+#if defined(__has_include)
+#if __has_include(<boost/scope/scope_all.hpp>)
+#include <boost/scope/scope_all.hpp>
+#define BOOST_SCOPE_TEST_HAS_AMALGAMATED_HEADER
+#endif
+#endif
+
+#if defined(BOOST_SCOPE_TEST_HAS_AMALGAMATED_HEADER)
+
+struct exit_func
+{
+    void operator()() const noexcept
+    {
+    }
+};
+
+//! Instantiates the guard destructors, which reference the inlined detail
+//! components (profile instrumentation hooks, the uncaught exception counter)
+void instantiate_components()
+{
+    boost::scope::scope_exit< exit_func > exit_guard{ exit_func() };
+    boost::scope::scope_fail< exit_func > fail_guard{ exit_func() };
+    boost::scope::scope_success< exit_func > success_guard{ exit_func() };
+    boost::scope::unique_fd fd(-1);
+    fd.reset();
+}
+
+#endif // defined(BOOST_SCOPE_TEST_HAS_AMALGAMATED_HEADER)
+
+int main(int, char*[])
+{
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   compact_storage_final.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests that empty final function objects are compacted
+ *         via [[no_unique_address]] where the attribute is supported.
+ */
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/fd_resource_traits.hpp>
+
+struct final_empty_deleter final
+{
+    typedef void result_type;
+
+    result_type operator() (int) const noexcept
+    {
+    }
+};
+
+#if defined(BOOST_SCOPE_HAS_NO_UNIQUE_ADDRESS)
+static_assert(
+    sizeof(boost::scope::unique_resource< int, final_empty_deleter, boost::scope::fd_resource_traits >) == sizeof(int),
+    "A final empty deleter must not increase unique_resource size when no_unique_address is supported");
+#endif
+
+int main(int, char*[])
+{
+    boost::scope::unique_resource< int, final_empty_deleter, boost::scope::fd_resource_traits > res(-1);
+    return res.allocated();
+}
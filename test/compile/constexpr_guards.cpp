@@ -0,0 +1,100 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   constexpr_guards.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests that \c scope_exit, \c scope_final and
+ *         \c unique_resource are usable in constant expressions when C++20
+ *         constexpr extensions are available. The test is a no-op otherwise.
+ */
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/scope_exit.hpp>
+#include <boost/scope/scope_final.hpp>
+#include <boost/scope/unique_resource.hpp>
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907l
+
+struct increment_action
+{
+    int* m_count;
+
+    constexpr void operator() () const noexcept
+    {
+        ++*m_count;
+    }
+};
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    int* m_deleted;
+
+    constexpr result_type operator() (int res) const noexcept
+    {
+        *m_deleted = res;
+    }
+};
+
+constexpr int test_scope_exit()
+{
+    int count = 0;
+    {
+        boost::scope::scope_exit< increment_action > guard{ increment_action{ &count } };
+        boost::scope::scope_exit< increment_action > inactive{ increment_action{ &count }, false };
+        boost::scope::scope_exit< increment_action > released{ increment_action{ &count } };
+        released.release();
+    }
+    return count;
+}
+
+static_assert(test_scope_exit() == 1, "scope_exit must invoke the action exactly once in constant evaluation");
+
+constexpr int test_scope_final()
+{
+    int count = 0;
+    {
+        boost::scope::scope_final< increment_action > guard{ increment_action{ &count } };
+    }
+    return count;
+}
+
+static_assert(test_scope_final() == 1, "scope_final must invoke the action in constant evaluation");
+
+constexpr int test_unique_resource()
+{
+    int deleted = 0;
+    {
+        boost::scope::unique_resource< int, int_deleter > ur{ 10, int_deleter{ &deleted } };
+        ur.reset(20);
+    }
+    return deleted;
+}
+
+static_assert(test_unique_resource() == 20, "unique_resource must release the resource in constant evaluation");
+
+constexpr bool test_unique_resource_release()
+{
+    int deleted = 0;
+    {
+        boost::scope::unique_resource< int, int_deleter > ur{ 30, int_deleter{ &deleted } };
+        ur.release();
+    }
+    return deleted == 0;
+}
+
+static_assert(test_unique_resource_release(), "unique_resource::release must prevent deleter invocation in constant evaluation");
+
+#endif // defined(__cpp_constexpr) && __cpp_constexpr >= 201907l
+
+int main()
+{
+    return 0;
+}
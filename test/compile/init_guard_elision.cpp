@@ -0,0 +1,90 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   init_guard_elision.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests that scope guard construction from nothrow-movable
+ *         function objects is itself noexcept, which pins the static bypass
+ *         of \c detail::init_guard: the nothrow tag-dispatched holder
+ *         constructors never instantiate the init guard, so fully-noexcept
+ *         guards produce no EH landing pads.
+ */
+
+#include <boost/scope/scope_exit.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/scope_success.hpp>
+#include <boost/scope/scope_final.hpp>
+#include <type_traits>
+
+struct nothrow_action
+{
+    int* m_count;
+
+    void operator() () const noexcept
+    {
+        ++*m_count;
+    }
+};
+
+struct throwing_copy_action
+{
+    int* m_count;
+
+    throwing_copy_action(int* count) noexcept : m_count(count) {}
+    throwing_copy_action(throwing_copy_action const& that) : m_count(that.m_count) {}
+
+    void operator() () const noexcept
+    {
+        ++*m_count;
+    }
+};
+
+struct nothrow_condition
+{
+    typedef bool result_type;
+
+    result_type operator() () const noexcept
+    {
+        return true;
+    }
+};
+
+// Guard construction from a nothrow-movable action must be noexcept. This is
+// only possible if the init_guard apparatus is statically bypassed, since the
+// init_guard path is selected exactly when the wrapped object construction
+// can throw.
+static_assert(std::is_nothrow_constructible< boost::scope::scope_exit< nothrow_action >, nothrow_action >::value,
+    "scope_exit construction from a nothrow-movable action must not engage init_guard");
+static_assert(std::is_nothrow_constructible<
+        boost::scope::scope_exit< nothrow_action, nothrow_condition >, nothrow_action, nothrow_condition >::value,
+    "scope_exit construction from nothrow-movable action and condition must not engage init_guard");
+static_assert(std::is_nothrow_constructible< boost::scope::scope_fail< nothrow_action >, nothrow_action >::value,
+    "scope_fail construction from a nothrow-movable action must not engage init_guard");
+static_assert(std::is_nothrow_constructible< boost::scope::scope_success< nothrow_action >, nothrow_action >::value,
+    "scope_success construction from a nothrow-movable action must not engage init_guard");
+static_assert(std::is_nothrow_constructible< boost::scope::scope_final< nothrow_action >, nothrow_action >::value,
+    "scope_final construction from a nothrow-movable action must not engage init_guard");
+
+// Destruction of a guard wrapping a noexcept action must be noexcept, so the
+// destructor contributes no EH landing pads to the enclosing function.
+static_assert(std::is_nothrow_destructible< boost::scope::scope_exit< nothrow_action > >::value,
+    "scope_exit destruction with a noexcept action must be noexcept");
+static_assert(std::is_nothrow_destructible< boost::scope::scope_final< nothrow_action > >::value,
+    "scope_final destruction with a noexcept action must be noexcept");
+
+// Sanity check: a throwing copy constructor does select the protected path,
+// so construction is correctly not noexcept there.
+static_assert(!std::is_nothrow_constructible<
+        boost::scope::scope_exit< throwing_copy_action >, throwing_copy_action& >::value,
+    "scope_exit construction from a throwing-copy action must remain potentially-throwing");
+
+int main()
+{
+    return 0;
+}
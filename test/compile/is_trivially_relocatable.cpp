@@ -0,0 +1,53 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   is_trivially_relocatable.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests \c is_trivially_relocatable trait.
+ */
+
+#include <boost/scope/is_trivially_relocatable.hpp>
+#include <boost/scope/unique_fd.hpp>
+
+struct nontrivial_deleter
+{
+    typedef void result_type;
+
+    nontrivial_deleter() noexcept
+    {
+    }
+
+    nontrivial_deleter(nontrivial_deleter const&) noexcept
+    {
+    }
+
+    ~nontrivial_deleter()
+    {
+    }
+
+    result_type operator() (int) const noexcept
+    {
+    }
+};
+
+static_assert(boost::scope::is_trivially_relocatable< int >::value,
+    "int must be trivially relocatable");
+static_assert(boost::scope::is_trivially_relocatable< boost::scope::unique_fd >::value,
+    "unique_fd must be trivially relocatable");
+static_assert(boost::scope::is_trivially_relocatable<
+        boost::scope::unique_resource< int, boost::scope::fd_deleter > >::value,
+    "unique_resource with trivially copyable resource and deleter must be trivially relocatable");
+static_assert(!boost::scope::is_trivially_relocatable<
+        boost::scope::unique_resource< int, nontrivial_deleter > >::value,
+    "unique_resource with a non-trivial deleter must not be trivially relocatable");
+
+int main(int, char*[])
+{
+    return 0;
+}
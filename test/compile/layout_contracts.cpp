@@ -0,0 +1,102 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   layout_contracts.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file pins the layout and codegen-relevant properties of the
+ *         main library components: the flag-free \c unique_fd layout, empty
+ *         member compression through \c detail::compact_storage, the tagged
+ *         function pointer guard layout, and nothrow movability. A failure
+ *         here means a refactoring changed the footprint of user handle
+ *         tables or guard frames.
+ */
+
+#include <boost/scope/detail/config.hpp>
+#include <boost/scope/scope_exit.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/scope_final.hpp>
+#include <boost/scope/unique_fd.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/fd_resource_traits.hpp>
+#include <boost/scope/error_code_checker.hpp>
+#include <type_traits>
+
+struct empty_action
+{
+    void operator() () const noexcept
+    {
+    }
+};
+
+struct empty_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int) const noexcept
+    {
+    }
+};
+
+// unique_fd: the resource traits represent the unallocated state as a
+// negative descriptor and fd_deleter is empty, so the wrapper must be exactly
+// one int — a unique_fd table must be byte-identical to a raw fd table.
+static_assert(sizeof(boost::scope::unique_fd) == sizeof(int),
+    "unique_fd must have the same size as a raw file descriptor");
+static_assert(std::is_nothrow_move_constructible< boost::scope::unique_fd >::value,
+    "unique_fd must be nothrow move constructible");
+
+// An empty user-defined deleter must be compressed by compact_storage
+static_assert(sizeof(boost::scope::unique_resource< int, empty_deleter, boost::scope::fd_resource_traits >) == sizeof(int),
+    "an empty deleter must not increase unique_resource size");
+
+// Without resource traits the wrapper needs an allocation flag, but no more
+// than that: resource, flag and padding
+static_assert(sizeof(boost::scope::unique_resource< int, empty_deleter >) <= 2u * sizeof(int),
+    "unique_resource without resource traits must only add an allocation flag");
+
+// Guards with empty action and condition must collapse to the active flag
+static_assert(sizeof(boost::scope::scope_exit< empty_action >) == sizeof(bool),
+    "scope_exit with an empty action must collapse to the active flag");
+static_assert(sizeof(boost::scope::scope_final< empty_action >) == sizeof(empty_action),
+    "scope_final with an empty action must remain empty-sized");
+
+// A guard wrapping a state reference stays at two words: the pointer-sized
+// condition plus the active flag
+static_assert(sizeof(boost::scope::scope_fail< empty_action, boost::scope::error_code_checker< int > >) <= 2u * sizeof(void*),
+    "scope_fail with an error_code_checker condition must fit in two words");
+
+#if defined(BOOST_SCOPE_HAS_TAGGED_FUNCTION_POINTERS)
+// Function pointer guards encode the active state in the low bit of the
+// pointer and must be a single machine word
+static_assert(sizeof(boost::scope::scope_exit< void (*)() noexcept >) == sizeof(void (*)()),
+    "scope_exit wrapping a function pointer must be a single machine word");
+#endif
+
+// Nothrow movability of the guards is what allows factory functions to
+// return them without introducing throw paths
+static_assert(std::is_nothrow_move_constructible< boost::scope::scope_exit< empty_action > >::value,
+    "scope_exit with a nothrow-movable action must be nothrow move constructible");
+static_assert(std::is_nothrow_move_constructible<
+        boost::scope::unique_resource< int, empty_deleter, boost::scope::fd_resource_traits > >::value,
+    "unique_resource with a nothrow-movable resource and deleter must be nothrow move constructible");
+
+// Storage triviality: the wrapper must not add non-trivial copy/destruction
+// machinery beyond the deleter invocation in its own destructor
+static_assert(std::is_trivially_copyable< boost::scope::fd_resource_traits >::value ||
+        std::is_empty< boost::scope::fd_resource_traits >::value,
+    "fd_resource_traits must remain stateless");
+static_assert(std::is_trivially_destructible< boost::scope::fd_deleter >::value,
+    "fd_deleter must be trivially destructible");
+static_assert(std::is_trivially_destructible< boost::scope::always_true >::value,
+    "always_true must be trivially destructible");
+
+int main(int, char*[])
+{
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   no_exceptions.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests that in BOOST_SCOPE_NO_EXCEPTIONS mode \c exception_checker
+ *         is a stateless predicate that statically returns \c false.
+ */
+
+#define BOOST_SCOPE_NO_EXCEPTIONS
+
+#include <boost/scope/exception_checker.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/scope_success.hpp>
+#include <type_traits>
+
+static_assert(std::is_empty< boost::scope::exception_checker >::value,
+    "exception_checker must be stateless in BOOST_SCOPE_NO_EXCEPTIONS mode");
+
+typedef boost::scope::scope_fail< void (*)() noexcept > scope_fail_t;
+typedef boost::scope::scope_success< void (*)() noexcept > scope_success_t;
+
+static_assert(std::is_nothrow_default_constructible< boost::scope::exception_checker >::value,
+    "exception_checker default construction must not throw in BOOST_SCOPE_NO_EXCEPTIONS mode");
+static_assert(std::is_nothrow_destructible< scope_fail_t >::value,
+    "scope_fail destruction must not throw in BOOST_SCOPE_NO_EXCEPTIONS mode");
+static_assert(std::is_nothrow_destructible< scope_success_t >::value,
+    "scope_success destruction must not throw in BOOST_SCOPE_NO_EXCEPTIONS mode");
+
+int main(int, char*[])
+{
+    return 0;
+}
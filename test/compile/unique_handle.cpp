@@ -0,0 +1,33 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_handle.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file tests that \c unique_handle has the compact flag-free
+ *         layout on Windows. The test is a no-op on other systems.
+ */
+
+#include <boost/scope/unique_handle.hpp>
+
+#if defined(BOOST_WINDOWS)
+
+static_assert(sizeof(boost::scope::unique_handle) == sizeof(boost::winapi::HANDLE_),
+    "unique_handle must not store a separate allocated flag");
+
+#endif // defined(BOOST_WINDOWS)
+
+int main(int, char*[])
+{
+#if defined(BOOST_WINDOWS)
+    boost::scope::unique_handle res;
+    return res.allocated();
+#else
+    return 0;
+#endif
+}
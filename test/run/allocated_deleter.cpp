@@ -0,0 +1,156 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   allocated_deleter.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c allocated_deleter.
+ */
+
+#include <boost/scope/allocated_deleter.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603l
+#include <memory_resource>
+#endif
+
+unsigned int g_deleted_count = 0u;
+int g_last_deleted = 0;
+
+//! A deleter fat enough that embedding it in every unique_resource would be wasteful
+struct fat_deleter
+{
+    typedef void result_type;
+
+    void* pool;
+    void (*completion)(int);
+    char telemetry_tag[64];
+
+    explicit fat_deleter(void* p = nullptr) noexcept :
+        pool(p),
+        completion(nullptr)
+    {
+        telemetry_tag[0] = '\0';
+    }
+
+    result_type operator() (int res) const noexcept
+    {
+        ++g_deleted_count;
+        g_last_deleted = res;
+    }
+};
+
+//! A bump-pointer arena allocator
+struct arena
+{
+    unsigned char buffer[4096];
+    std::size_t pos = 0u;
+    unsigned int alloc_count = 0u;
+    unsigned int dealloc_count = 0u;
+};
+
+template< typename T >
+class arena_allocator
+{
+public:
+    typedef T value_type;
+
+    arena* m_arena;
+
+    explicit arena_allocator(arena* a) noexcept :
+        m_arena(a)
+    {
+    }
+
+    template< typename U >
+    arena_allocator(arena_allocator< U > const& that) noexcept :
+        m_arena(that.m_arena)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        std::size_t pos = (m_arena->pos + alignof(T) - 1u) & ~(alignof(T) - 1u);
+        if ((pos + n * sizeof(T)) > sizeof(m_arena->buffer))
+            throw std::bad_alloc();
+
+        m_arena->pos = pos + n * sizeof(T);
+        ++m_arena->alloc_count;
+        return reinterpret_cast< T* >(m_arena->buffer + pos);
+    }
+
+    void deallocate(T*, std::size_t) noexcept
+    {
+        ++m_arena->dealloc_count;
+    }
+};
+
+int main()
+{
+    // The deleter is constructed in the arena and destroyed with it
+    {
+        arena a;
+        g_deleted_count = 0u;
+        {
+            boost::scope::unique_resource< int, boost::scope::allocated_deleter< fat_deleter, arena_allocator< fat_deleter > > > ur{
+                10, boost::scope::allocate_deleter(fat_deleter(), arena_allocator< fat_deleter >(&a)) };
+            BOOST_TEST(ur.allocated());
+            BOOST_TEST_EQ(a.alloc_count, 1u);
+        }
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 10);
+        BOOST_TEST_EQ(a.dealloc_count, 1u);
+    }
+
+    // The wrapper stays small regardless of the wrapped deleter size
+    {
+        static_assert(sizeof(boost::scope::allocated_deleter< fat_deleter, arena_allocator< fat_deleter > >) <= 2u * sizeof(void*),
+            "allocated_deleter must not embed the wrapped deleter");
+        static_assert(sizeof(boost::scope::allocated_deleter< fat_deleter >) <= 2u * sizeof(void*),
+            "allocated_deleter with a stateless allocator must be a single pointer");
+    }
+
+    // Moving transfers ownership of the out-of-line deleter
+    {
+        arena a;
+        g_deleted_count = 0u;
+        {
+            typedef boost::scope::allocated_deleter< fat_deleter, arena_allocator< fat_deleter > > deleter_t;
+            deleter_t del1{ fat_deleter(), arena_allocator< fat_deleter >(&a) };
+            deleter_t del2(static_cast< deleter_t&& >(del1));
+            del2(20);
+        }
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 20);
+        BOOST_TEST_EQ(a.alloc_count, 1u);
+        BOOST_TEST_EQ(a.dealloc_count, 1u);
+    }
+
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603l
+    // polymorphic_allocator works as the storage allocator
+    {
+        unsigned char buffer[1024];
+        std::pmr::monotonic_buffer_resource mr(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+        g_deleted_count = 0u;
+        {
+            typedef boost::scope::allocated_deleter< fat_deleter, std::pmr::polymorphic_allocator< fat_deleter > > deleter_t;
+            boost::scope::unique_resource< int, deleter_t > ur{
+                30, deleter_t(fat_deleter(), std::pmr::polymorphic_allocator< fat_deleter >(&mr)) };
+        }
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 30);
+    }
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,128 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   any_scope_exit.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c any_scope_exit.
+ */
+
+#include <boost/scope/any_scope_exit.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <new>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+unsigned int g_allocation_count = 0u;
+
+void* operator new (std::size_t size)
+{
+    ++g_allocation_count;
+    void* p = std::malloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete (void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete (void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+int main()
+{
+    // The basic active guard invokes the action on destruction
+    {
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::any_scope_exit guard([&invoked_count]() { ++invoked_count; });
+            BOOST_TEST(guard.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // An empty guard is inactive and cannot be activated
+    {
+        boost::scope::any_scope_exit guard;
+        BOOST_TEST(!guard.active());
+        guard.set_active(true);
+        BOOST_TEST(!guard.active());
+    }
+
+    // Deactivation suppresses the action
+    {
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::any_scope_exit guard([&invoked_count]() { ++invoked_count; });
+            guard.set_active(false);
+        }
+        BOOST_TEST_EQ(invoked_count, 0u);
+
+        {
+            boost::scope::any_scope_exit guard([&invoked_count]() { ++invoked_count; }, false);
+            BOOST_TEST(!guard.active());
+            guard.set_active(true);
+            BOOST_TEST(guard.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Small captures fit in the inline buffer and do not allocate
+    {
+        unsigned int invoked_count = 0u;
+        g_allocation_count = 0u;
+        {
+            boost::scope::any_scope_exit guard([&invoked_count]() { ++invoked_count; });
+            BOOST_TEST_EQ(g_allocation_count, 0u);
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Large captures fall back to the heap and still work
+    {
+        unsigned int invoked_count = 0u;
+        char big_payload[64] = {};
+        g_allocation_count = 0u;
+        {
+            boost::scope::any_scope_exit guard([&invoked_count, big_payload]() { invoked_count += 1u + big_payload[0]; });
+            BOOST_TEST_EQ(g_allocation_count, 1u);
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Moving transfers the action and deactivates the source
+    {
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::any_scope_exit guard1([&invoked_count]() { ++invoked_count; });
+            boost::scope::any_scope_exit guard2(static_cast< boost::scope::any_scope_exit&& >(guard1));
+            BOOST_TEST(!guard1.active());
+            BOOST_TEST(guard2.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Guards can be stored in containers
+    {
+        unsigned int invoked_count = 0u;
+        {
+            std::vector< boost::scope::any_scope_exit > guards;
+            for (unsigned int i = 0u; i < 10u; ++i)
+                guards.emplace_back([&invoked_count]() { ++invoked_count; });
+        }
+        BOOST_TEST_EQ(invoked_count, 10u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,158 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   async_unique_resource.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c async_unique_resource.
+ *         The test is a no-op when coroutines are not supported.
+ */
+
+#include <boost/scope/async_unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+#include <coroutine>
+#include <exception>
+
+//! A fire-and-forget coroutine that runs to completion synchronously
+struct test_coro
+{
+    struct promise_type
+    {
+        test_coro get_return_object() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+unsigned int g_started_count = 0u;
+unsigned int g_completed_count = 0u;
+int g_last_deleted = 0;
+
+//! An immediately-ready awaitable that records release completion
+struct release_awaitable
+{
+    bool await_ready() const noexcept
+    {
+        return true;
+    }
+
+    void await_suspend(std::coroutine_handle<>) const noexcept
+    {
+    }
+
+    void await_resume() const noexcept
+    {
+        ++g_completed_count;
+    }
+};
+
+struct async_int_deleter
+{
+    release_awaitable operator() (int res) const noexcept
+    {
+        ++g_started_count;
+        g_last_deleted = res;
+        return {};
+    }
+};
+
+typedef boost::scope::async_unique_resource< int, async_int_deleter > async_unique_int;
+
+test_coro reset_releases(int value)
+{
+    async_unique_int ur(value);
+    BOOST_TEST(ur.allocated());
+    BOOST_TEST_EQ(ur.get(), value);
+
+    co_await ur.async_reset();
+    BOOST_TEST(!ur.allocated());
+}
+
+int main()
+{
+    // A default-constructed wrapper owns nothing
+    {
+        async_unique_int ur;
+        BOOST_TEST(!ur.allocated());
+    }
+    BOOST_TEST_EQ(g_started_count, 0u);
+
+    // async_reset() releases the resource and its awaitable signals completion
+    {
+        reset_releases(10);
+        BOOST_TEST_EQ(g_started_count, 1u);
+        BOOST_TEST_EQ(g_completed_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 10);
+    }
+
+    // The destructor is a synchronous backstop
+    {
+        {
+            async_unique_int ur(20);
+        }
+        BOOST_TEST_EQ(g_started_count, 2u);
+        BOOST_TEST_EQ(g_last_deleted, 20);
+    }
+
+    // release() gives up ownership without deallocating
+    {
+        {
+            async_unique_int ur(30);
+            ur.release();
+            BOOST_TEST(!ur.allocated());
+        }
+        BOOST_TEST_EQ(g_started_count, 2u);
+    }
+
+    // Moving transfers ownership
+    {
+        {
+            async_unique_int ur1(40);
+            async_unique_int ur2(static_cast< async_unique_int&& >(ur1));
+            BOOST_TEST(!ur1.allocated());
+            BOOST_TEST(ur2.allocated());
+            BOOST_TEST_EQ(ur2.get(), 40);
+        }
+        BOOST_TEST_EQ(g_started_count, 3u);
+        BOOST_TEST_EQ(g_last_deleted, 40);
+    }
+
+    return boost::report_errors();
+}
+
+#else // defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+int main()
+{
+    return 0;
+}
+
+#endif // defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
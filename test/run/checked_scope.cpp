@@ -0,0 +1,114 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   checked_scope.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c checked_scope.
+ */
+
+#include <boost/scope/checked_scope.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/scope_success.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+#include "function_types.hpp"
+
+void check_normal()
+{
+    int fail_n = 0, success_n = 0;
+    {
+        boost::scope::checked_scope scope;
+        BOOST_TEST(!scope.failed());
+        boost::scope::scope_fail< normal_func, boost::scope::checked_scope::failure_condition >
+            fail_guard{ normal_func(fail_n), scope.check_failure() };
+        boost::scope::scope_success< normal_func, boost::scope::checked_scope::failure_condition >
+            success_guard{ normal_func(success_n), scope.check_failure() };
+        BOOST_TEST(fail_guard.active());
+        BOOST_TEST(success_guard.active());
+    }
+    BOOST_TEST_EQ(fail_n, 0);
+    BOOST_TEST_EQ(success_n, 1);
+}
+
+void check_throw()
+{
+    int fail_n1 = 0, fail_n2 = 0, success_n = 0;
+    try
+    {
+        boost::scope::checked_scope scope;
+        boost::scope::scope_fail< normal_func, boost::scope::checked_scope::failure_condition >
+            fail_guard1{ normal_func(fail_n1), scope.check_failure() };
+        boost::scope::scope_fail< normal_func, boost::scope::checked_scope::failure_condition >
+            fail_guard2{ normal_func(fail_n2), scope.check_failure() };
+        boost::scope::scope_success< normal_func, boost::scope::checked_scope::failure_condition >
+            success_guard{ normal_func(success_n), scope.check_failure() };
+        throw std::runtime_error("error");
+    }
+    catch (...)
+    {
+    }
+    BOOST_TEST_EQ(fail_n1, 1);
+    BOOST_TEST_EQ(fail_n2, 1);
+    BOOST_TEST_EQ(success_n, 0);
+}
+
+void check_deactivated()
+{
+    int fail_n = 0;
+    try
+    {
+        boost::scope::checked_scope scope;
+        boost::scope::scope_fail< normal_func, boost::scope::checked_scope::failure_condition >
+            fail_guard{ normal_func(fail_n), scope.check_failure() };
+        fail_guard.release();
+        BOOST_TEST(!fail_guard.active());
+        throw std::runtime_error("error");
+    }
+    catch (...)
+    {
+    }
+    BOOST_TEST_EQ(fail_n, 0);
+}
+
+void check_nested()
+{
+    int outer_n = 0, inner_n = 0;
+    try
+    {
+        boost::scope::checked_scope outer_scope;
+        boost::scope::scope_fail< normal_func, boost::scope::checked_scope::failure_condition >
+            outer_guard{ normal_func(outer_n), outer_scope.check_failure() };
+        try
+        {
+            boost::scope::checked_scope inner_scope;
+            boost::scope::scope_fail< normal_func, boost::scope::checked_scope::failure_condition >
+                inner_guard{ normal_func(inner_n), inner_scope.check_failure() };
+            throw std::runtime_error("error");
+        }
+        catch (...)
+        {
+        }
+        BOOST_TEST(!outer_scope.failed());
+    }
+    catch (...)
+    {
+    }
+    BOOST_TEST_EQ(inner_n, 1);
+    BOOST_TEST_EQ(outer_n, 0);
+}
+
+int main()
+{
+    check_normal();
+    check_throw();
+    check_deactivated();
+    check_nested();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,150 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   co_scope_exit.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c co_scope_exit.
+ *         The test is a no-op when coroutines are not supported.
+ */
+
+#include <boost/scope/co_scope_exit.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+#include <coroutine>
+#include <exception>
+
+//! A fire-and-forget coroutine that runs to completion synchronously
+struct test_coro
+{
+    struct promise_type
+    {
+        test_coro get_return_object() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+//! An immediately-ready awaitable that records its completion
+struct cleanup_awaitable
+{
+    unsigned int* m_completed_count;
+
+    bool await_ready() const noexcept
+    {
+        return true;
+    }
+
+    void await_suspend(std::coroutine_handle<>) const noexcept
+    {
+    }
+
+    void await_resume() const noexcept
+    {
+        ++*m_completed_count;
+    }
+};
+
+test_coro void_action_with_leave(unsigned int& invoked_count)
+{
+    auto guard = boost::scope::make_co_scope_exit([&invoked_count]() { ++invoked_count; });
+    co_await guard.leave();
+    BOOST_TEST(!guard.active());
+}
+
+test_coro void_action_without_leave(unsigned int& invoked_count)
+{
+    auto guard = boost::scope::make_co_scope_exit([&invoked_count]() { ++invoked_count; });
+    co_return;
+}
+
+test_coro awaitable_action(unsigned int& started_count, unsigned int& completed_count)
+{
+    auto guard = boost::scope::make_co_scope_exit([&]() -> cleanup_awaitable
+    {
+        ++started_count;
+        return cleanup_awaitable{ &completed_count };
+    });
+
+    BOOST_TEST_EQ(started_count, 0u);
+    co_await guard.leave();
+    BOOST_TEST_EQ(started_count, 1u);
+    BOOST_TEST_EQ(completed_count, 1u);
+}
+
+test_coro deactivated_action(unsigned int& invoked_count)
+{
+    auto guard = boost::scope::make_co_scope_exit([&invoked_count]() { ++invoked_count; });
+    guard.set_active(false);
+    co_await guard.leave();
+}
+
+int main()
+{
+    // leave() invokes the action once; the destructor does not re-invoke it
+    {
+        unsigned int invoked_count = 0u;
+        void_action_with_leave(invoked_count);
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // The destructor is a synchronous backstop when leave() was not awaited
+    {
+        unsigned int invoked_count = 0u;
+        void_action_without_leave(invoked_count);
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Awaitable-returning actions are invoked and their awaitable awaited
+    {
+        unsigned int started_count = 0u, completed_count = 0u;
+        awaitable_action(started_count, completed_count);
+        BOOST_TEST_EQ(started_count, 1u);
+        BOOST_TEST_EQ(completed_count, 1u);
+    }
+
+    // A deactivated guard does nothing
+    {
+        unsigned int invoked_count = 0u;
+        deactivated_action(invoked_count);
+        BOOST_TEST_EQ(invoked_count, 0u);
+    }
+
+    return boost::report_errors();
+}
+
+#else // defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
+
+int main()
+{
+    return 0;
+}
+
+#endif // defined(BOOST_SCOPE_HAS_CO_SCOPE_EXIT)
@@ -0,0 +1,95 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   crash_scope_exit.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c crash_scope_exit.
+ */
+
+#include <boost/scope/crash_scope_exit.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+unsigned int g_invoked_count = 0u;
+
+void count_invocation(void* context)
+{
+    ++g_invoked_count;
+    if (context)
+        ++*static_cast< unsigned int* >(context);
+}
+
+int main()
+{
+    // A registered action runs once and is cleared
+    {
+        g_invoked_count = 0u;
+        unsigned int context_count = 0u;
+
+        boost::scope::crash_scope_exit guard(&count_invocation, &context_count);
+        BOOST_TEST(guard.registered());
+
+        BOOST_TEST_EQ(boost::scope::run_crash_scope_exits(), 1u);
+        BOOST_TEST_EQ(g_invoked_count, 1u);
+        BOOST_TEST_EQ(context_count, 1u);
+
+        // The action was consumed; a second run does nothing
+        BOOST_TEST_EQ(boost::scope::run_crash_scope_exits(), 0u);
+        BOOST_TEST_EQ(g_invoked_count, 1u);
+    }
+
+    // A destroyed guard does not run
+    {
+        g_invoked_count = 0u;
+        {
+            boost::scope::crash_scope_exit guard(&count_invocation);
+            BOOST_TEST(guard.registered());
+        }
+        BOOST_TEST_EQ(boost::scope::run_crash_scope_exits(), 0u);
+        BOOST_TEST_EQ(g_invoked_count, 0u);
+    }
+
+    // Moving transfers the registration
+    {
+        g_invoked_count = 0u;
+        {
+            boost::scope::crash_scope_exit guard1(&count_invocation);
+            boost::scope::crash_scope_exit guard2(static_cast< boost::scope::crash_scope_exit&& >(guard1));
+            BOOST_TEST(!guard1.registered());
+            BOOST_TEST(guard2.registered());
+        }
+        BOOST_TEST_EQ(boost::scope::run_crash_scope_exits(), 0u);
+    }
+
+    // All registered actions run; slots are recycled after deregistration
+    {
+        g_invoked_count = 0u;
+        {
+            std::vector< boost::scope::crash_scope_exit > guards;
+            for (unsigned int i = 0u; i < BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY; ++i)
+            {
+                guards.emplace_back(&count_invocation);
+                BOOST_TEST(guards.back().registered());
+            }
+
+            // The registry is full now
+            boost::scope::crash_scope_exit overflow_guard(&count_invocation);
+            BOOST_TEST(!overflow_guard.registered());
+
+            BOOST_TEST_EQ(boost::scope::run_crash_scope_exits(),
+                static_cast< unsigned int >(BOOST_SCOPE_CRASH_SCOPE_EXIT_CAPACITY));
+        }
+
+        // Slots freed by the destructors are available again
+        boost::scope::crash_scope_exit guard(&count_invocation);
+        BOOST_TEST(guard.registered());
+    }
+
+    return boost::report_errors();
+}
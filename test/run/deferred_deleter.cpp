@@ -0,0 +1,111 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   deferred_deleter.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c deferred_deleter and
+ *         \c deferred_cleanup_queue.
+ */
+
+#include <boost/scope/deferred_deleter.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+std::atomic< unsigned int > g_deleted_count{ 0u };
+int g_last_deleted = 0;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        g_deleted_count.fetch_add(1u, std::memory_order_relaxed);
+        g_last_deleted = res;
+    }
+};
+
+int main()
+{
+    // Destroying the resource only enqueues the deallocation
+    {
+        boost::scope::deferred_cleanup_queue queue;
+        typedef boost::scope::deferred_deleter< int_deleter > deleter_type;
+
+        {
+            boost::scope::unique_resource< int, deleter_type > ur(10, deleter_type(queue));
+            BOOST_TEST(ur.allocated());
+        }
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 0u);
+
+        BOOST_TEST_EQ(queue.drain(), 1u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 1u);
+        BOOST_TEST_EQ(g_last_deleted, 10);
+
+        BOOST_TEST_EQ(queue.drain(), 0u);
+    }
+
+    // Entries are drained in push order
+    {
+        boost::scope::deferred_cleanup_queue queue;
+        queue.push(20, int_deleter());
+        queue.push(30, int_deleter());
+        BOOST_TEST_EQ(queue.drain(), 2u);
+        BOOST_TEST_EQ(g_last_deleted, 30);
+    }
+
+    // Destroying the queue drains the remaining entries
+    {
+        {
+            boost::scope::deferred_cleanup_queue queue;
+            queue.push(40, int_deleter());
+        }
+        BOOST_TEST_EQ(g_last_deleted, 40);
+    }
+
+    // Concurrent producers with a single consumer
+    {
+        g_deleted_count.store(0u, std::memory_order_relaxed);
+
+        boost::scope::deferred_cleanup_queue queue;
+        const unsigned int thread_count = 4u;
+        const unsigned int pushes_per_thread = 1000u;
+
+        std::vector< std::thread > threads;
+        for (unsigned int i = 0u; i < thread_count; ++i)
+        {
+            threads.emplace_back([&queue]()
+            {
+                typedef boost::scope::deferred_deleter< int_deleter > deleter_type;
+                for (unsigned int j = 0u; j < pushes_per_thread; ++j)
+                {
+                    boost::scope::unique_resource< int, deleter_type > ur(static_cast< int >(j), deleter_type(queue));
+                }
+            });
+        }
+
+        std::size_t drained_count = 0u;
+        while (drained_count < thread_count * pushes_per_thread)
+        {
+            drained_count += queue.drain();
+            std::this_thread::yield();
+        }
+
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            threads[i].join();
+
+        BOOST_TEST_EQ(drained_count, thread_count * pushes_per_thread);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), thread_count * pushes_per_thread);
+    }
+
+    return boost::report_errors();
+}
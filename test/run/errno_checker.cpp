@@ -0,0 +1,66 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   errno_checker.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c errno_checker.
+ */
+
+#include <boost/scope/errno_checker.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cerrno>
+
+void check_lazy_sampling()
+{
+    boost::scope::errno_checker checker;
+
+    errno = 0;
+    BOOST_TEST(!checker());
+
+    errno = EINVAL;
+    BOOST_TEST(checker());
+
+    errno = 0;
+    BOOST_TEST(!checker());
+}
+
+void check_scope_fail()
+{
+    unsigned int invoked_count = 0u;
+    auto action = [&invoked_count]() noexcept { ++invoked_count; };
+
+    errno = 0;
+    {
+        boost::scope::scope_fail< decltype(action), boost::scope::errno_checker > guard{ action };
+        static_cast< void >(guard);
+    }
+    BOOST_TEST_EQ(invoked_count, 0u);
+
+    errno = 0;
+    {
+        boost::scope::scope_fail< decltype(action), boost::scope::errno_checker > guard{ action };
+        errno = ENOENT;
+    }
+    BOOST_TEST_EQ(invoked_count, 1u);
+
+    // A stateless condition adds no storage to the guard
+    static_assert(sizeof(boost::scope::scope_fail< void (*)(), boost::scope::errno_checker >) <= 2u * sizeof(void*),
+        "scope_fail with errno_checker is expected to be no larger than the action plus the active flag");
+
+    errno = 0;
+}
+
+int main()
+{
+    check_lazy_sampling();
+    check_scope_fail();
+
+    return boost::report_errors();
+}
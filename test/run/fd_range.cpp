@@ -0,0 +1,108 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   fd_range.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c unique_fd_range and \c close_fds.
+ *         The test is a no-op on Windows.
+ */
+
+#include <boost/scope/fd_range.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+//! Duplicates an open descriptor onto the specified descriptor number
+bool dup_onto(int source_fd, int fd)
+{
+    return ::dup2(source_fd, fd) == fd;
+}
+
+//! Tests if the descriptor is open
+bool is_open(int fd)
+{
+    return ::fcntl(fd, F_GETFD) >= 0 || errno != EBADF;
+}
+
+int main()
+{
+    static_assert(sizeof(boost::scope::unique_fd_range) == sizeof(boost::scope::fd_range),
+        "unique_fd_range must not store a separate allocated flag");
+
+    int source_fd = ::open("/dev/null", O_RDONLY);
+    BOOST_TEST_GE(source_fd, 0);
+
+    {
+        boost::scope::unique_fd_range range;
+        BOOST_TEST(!range.allocated());
+    }
+
+    {
+        for (int fd = 100; fd <= 104; ++fd)
+            BOOST_TEST(dup_onto(source_fd, fd));
+
+        {
+            boost::scope::fd_range r = { 100, 104 };
+            boost::scope::unique_fd_range range(r);
+            BOOST_TEST(range.allocated());
+            BOOST_TEST_EQ(range.get().first, 100);
+            BOOST_TEST_EQ(range.get().last, 104);
+        }
+
+        for (int fd = 100; fd <= 104; ++fd)
+            BOOST_TEST(!is_open(fd));
+    }
+
+    {
+        const int scattered_fds[] = { 100, 101, 102, 110, 115, 116 };
+        for (unsigned int i = 0u; i < sizeof(scattered_fds) / sizeof(*scattered_fds); ++i)
+            BOOST_TEST(dup_onto(source_fd, scattered_fds[i]));
+        BOOST_TEST(dup_onto(source_fd, 120)); // must survive the bulk close
+
+        // Unsorted, with duplicates and invalid entries
+        int fds[] = { 115, 100, -1, 102, 101, 116, 110, 101 };
+        boost::scope::close_fds(fds, sizeof(fds) / sizeof(*fds));
+
+        for (unsigned int i = 0u; i < sizeof(scattered_fds) / sizeof(*scattered_fds); ++i)
+            BOOST_TEST(!is_open(scattered_fds[i]));
+        BOOST_TEST(is_open(120));
+        ::close(120);
+    }
+
+    // fd_deleter closes whole batches through its batch call operator
+    {
+        const int batch_fds[] = { 100, 101, 102, 110 };
+        for (unsigned int i = 0u; i < sizeof(batch_fds) / sizeof(*batch_fds); ++i)
+            BOOST_TEST(dup_onto(source_fd, batch_fds[i]));
+
+        boost::scope::fd_deleter()(batch_fds, sizeof(batch_fds) / sizeof(*batch_fds));
+
+        for (unsigned int i = 0u; i < sizeof(batch_fds) / sizeof(*batch_fds); ++i)
+            BOOST_TEST(!is_open(batch_fds[i]));
+    }
+
+    ::close(source_fd);
+
+    return boost::report_errors();
+}
+
+#else // !defined(BOOST_WINDOWS)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_WINDOWS)
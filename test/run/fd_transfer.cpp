@@ -0,0 +1,127 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   fd_transfer.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c send_fds and \c receive_fds.
+ */
+
+#include <boost/scope/detail/config.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <boost/scope/fd_transfer.hpp>
+#include <boost/scope/unique_fd.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+//! Checks whether the file descriptor is open
+bool is_open_fd(int fd)
+{
+    return ::fcntl(fd, F_GETFD) >= 0 || errno != EBADF;
+}
+
+int main()
+{
+    // A batch of descriptors moves through one message and arrives owned
+    {
+        int sockets[2];
+        BOOST_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+        boost::scope::unique_fd sent_fds[3];
+        int raw_fds[3];
+        for (unsigned int i = 0u; i < 3u; ++i)
+        {
+            sent_fds[i] = boost::scope::unique_fd(::dup(STDOUT_FILENO));
+            BOOST_TEST(sent_fds[i].allocated());
+            raw_fds[i] = sent_fds[i].get();
+        }
+
+        BOOST_TEST(boost::scope::send_fds(sockets[0], sent_fds, 3u));
+
+        // The sender's descriptors are closed; the open file descriptions
+        // live on in the message
+        for (unsigned int i = 0u; i < 3u; ++i)
+        {
+            BOOST_TEST(!sent_fds[i].allocated());
+            BOOST_TEST(!is_open_fd(raw_fds[i]));
+        }
+
+        boost::scope::unique_fd received_fds[3];
+        BOOST_TEST_EQ(boost::scope::receive_fds(sockets[1], received_fds, 3u), 3u);
+
+        for (unsigned int i = 0u; i < 3u; ++i)
+        {
+            BOOST_TEST(received_fds[i].allocated());
+
+            // The received descriptor refers to a working open file description
+            BOOST_TEST(::write(received_fds[i].get(), "", 0u) == 0);
+        }
+
+        ::close(sockets[0]);
+        ::close(sockets[1]);
+    }
+
+    // Excess descriptors beyond the receiver capacity are closed, not leaked
+    {
+        int sockets[2];
+        BOOST_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+        boost::scope::unique_fd sent_fds[4];
+        for (unsigned int i = 0u; i < 4u; ++i)
+            sent_fds[i] = boost::scope::unique_fd(::dup(STDOUT_FILENO));
+
+        BOOST_TEST(boost::scope::send_fds(sockets[0], sent_fds, 4u));
+
+        boost::scope::unique_fd received_fds[2];
+        BOOST_TEST_EQ(boost::scope::receive_fds(sockets[1], received_fds, 2u), 2u);
+        BOOST_TEST(received_fds[0].allocated());
+        BOOST_TEST(received_fds[1].allocated());
+
+        ::close(sockets[0]);
+        ::close(sockets[1]);
+    }
+
+    // A failed send leaves ownership with the caller
+    {
+        boost::scope::unique_fd sent_fds[1];
+        sent_fds[0] = boost::scope::unique_fd(::dup(STDOUT_FILENO));
+        BOOST_TEST(sent_fds[0].allocated());
+
+        BOOST_TEST(!boost::scope::send_fds(-1, sent_fds, 1u));
+        BOOST_TEST(sent_fds[0].allocated());
+    }
+
+    // An orderly peer shutdown yields zero descriptors
+    {
+        int sockets[2];
+        BOOST_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+        ::close(sockets[0]);
+
+        boost::scope::unique_fd received_fds[1];
+        BOOST_TEST_EQ(boost::scope::receive_fds(sockets[1], received_fds, 1u), 0u);
+
+        ::close(sockets[1]);
+    }
+
+    return boost::report_errors();
+}
+
+#else // !defined(BOOST_WINDOWS)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_WINDOWS)
@@ -0,0 +1,73 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   inplace_scope_guard_list.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c inplace_scope_guard_list.
+ */
+
+#include <boost/scope/inplace_scope_guard_list.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+int main()
+{
+    // An empty list is harmless
+    {
+        boost::scope::inplace_scope_guard_list< 4u > list;
+        BOOST_TEST(list.active());
+        BOOST_TEST_EQ(list.size(), 0u);
+        BOOST_TEST_EQ(list.capacity(), 4u);
+        BOOST_TEST(!list.full());
+    }
+
+    // Actions run in LIFO order
+    {
+        std::vector< int > order;
+        {
+            boost::scope::inplace_scope_guard_list< 8u > list;
+            for (int i = 0; i < 8; ++i)
+            {
+                BOOST_TEST(list.push([&order, i]() { order.push_back(i); }));
+            }
+            BOOST_TEST(list.full());
+        }
+
+        BOOST_TEST_EQ(order.size(), 8u);
+        for (unsigned int i = 0u; i < order.size(); ++i)
+            BOOST_TEST_EQ(order[i], static_cast< int >(7u - i));
+    }
+
+    // Pushing into a full list fails and does not register the action
+    {
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::inplace_scope_guard_list< 1u > list;
+            BOOST_TEST(list.push([&invoked_count]() { ++invoked_count; }));
+            BOOST_TEST(!list.push([&invoked_count]() { invoked_count += 100u; }));
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // A deactivated list discards the actions without invoking them
+    {
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::inplace_scope_guard_list< 4u > list;
+            list.push([&invoked_count]() { ++invoked_count; });
+            list.push([&invoked_count]() { ++invoked_count; });
+
+            list.set_active(false);
+            BOOST_TEST(!list.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 0u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,79 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   io_uring_fd_deleter.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c io_uring_fd_deleter.
+ *         The test is a no-op on Windows.
+ */
+
+#include <boost/scope/io_uring_fd_deleter.hpp>
+#include <boost/scope/fd_resource_traits.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+typedef boost::scope::unique_resource< int, boost::scope::io_uring_fd_deleter, boost::scope::fd_resource_traits > unique_uring_fd;
+
+//! Tests if the descriptor is open
+bool is_open(int fd)
+{
+    return ::fcntl(fd, F_GETFD) >= 0 || errno != EBADF;
+}
+
+int main()
+{
+    static_assert(sizeof(unique_uring_fd) == sizeof(int),
+        "unique_resource with io_uring_fd_deleter must not store a separate allocated flag");
+
+    {
+        unique_uring_fd ur;
+        BOOST_TEST(!ur.allocated());
+    }
+
+    // Exceed a submission batch to exercise batched submission and reaping.
+    // If io_uring is unavailable at runtime, the deleter closes synchronously
+    // and the test degenerates to checking the fallback path.
+    const unsigned int fd_count = 100u;
+    int fds[fd_count];
+    for (unsigned int i = 0u; i < fd_count; ++i)
+    {
+        fds[i] = ::open("/dev/null", O_RDONLY);
+        BOOST_TEST_GE(fds[i], 0);
+    }
+
+    for (unsigned int i = 0u; i < fd_count; ++i)
+    {
+        unique_uring_fd ur(fds[i]);
+        BOOST_TEST(ur.allocated());
+    }
+
+    boost::scope::io_uring_fd_deleter::flush();
+
+    for (unsigned int i = 0u; i < fd_count; ++i)
+        BOOST_TEST(!is_open(fds[i]));
+
+    return boost::report_errors();
+}
+
+#else // !defined(BOOST_WINDOWS)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_WINDOWS)
@@ -0,0 +1,179 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   parallel_reset.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c parallel_reset.
+ */
+
+#include <boost/scope/parallel_reset.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/scope/sentinel_resource_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <functional>
+
+std::atomic< unsigned int > g_deleted_count{ 0u };
+std::vector< std::atomic< unsigned int > > g_deleted_flags;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        g_deleted_count.fetch_add(1u, std::memory_order_relaxed);
+        g_deleted_flags[static_cast< std::size_t >(res)].fetch_add(1u, std::memory_order_relaxed);
+    }
+};
+
+typedef boost::scope::sentinel_resource_traits< int, -1 > int_resource_traits;
+typedef boost::scope::unique_resource< int, int_deleter, int_resource_traits > unique_int;
+
+//! Fills the flag array and constructs a range of owned resources
+std::vector< unique_int > make_resources(std::size_t count)
+{
+    g_deleted_count.store(0u, std::memory_order_relaxed);
+    g_deleted_flags = std::vector< std::atomic< unsigned int > >(count);
+
+    std::vector< unique_int > resources;
+    resources.reserve(count);
+    for (std::size_t i = 0u; i < count; ++i)
+        resources.emplace_back(static_cast< int >(i));
+    return resources;
+}
+
+//! Verifies that every resource was released exactly once
+bool all_deleted_once(std::size_t count)
+{
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        if (g_deleted_flags[i].load(std::memory_order_relaxed) != 1u)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    // The temporary-thread overload releases every resource exactly once
+    {
+        const std::size_t count = 10000u;
+        std::vector< unique_int > resources = make_resources(count);
+
+        boost::scope::parallel_reset(resources.begin(), resources.end(), 4u);
+
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), count);
+        BOOST_TEST(all_deleted_once(count));
+        for (unique_int& res : resources)
+            BOOST_TEST(!res.allocated());
+    }
+
+    // Already released elements are skipped
+    {
+        const std::size_t count = 100u;
+        std::vector< unique_int > resources = make_resources(count);
+        resources[10].reset();
+        resources[20].release();
+
+        boost::scope::parallel_reset(resources.begin(), resources.end(), 4u);
+
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), count - 1u);
+        BOOST_TEST_EQ(g_deleted_flags[20].load(std::memory_order_relaxed), 0u);
+    }
+
+    // A range smaller than the partition count is handled
+    {
+        std::vector< unique_int > resources = make_resources(2u);
+        boost::scope::parallel_reset(resources.begin(), resources.end(), 8u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 2u);
+    }
+
+    // Partition size rounding can yield fewer partitions than requested
+    // (7 elements in 6 partitions produce 4 partitions of 2); the call must
+    // still complete and release everything
+    {
+        std::vector< unique_int > resources = make_resources(7u);
+
+        unsigned int submitted_count = 0u;
+        std::vector< std::thread > workers;
+        boost::scope::parallel_reset(resources.begin(), resources.end(),
+            [&submitted_count, &workers](std::function< void() > task)
+            {
+                ++submitted_count;
+                workers.emplace_back(std::move(task));
+            },
+            6u);
+        for (std::thread& worker : workers)
+            worker.join();
+
+        BOOST_TEST_EQ(submitted_count, 3u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 7u);
+        BOOST_TEST(all_deleted_once(7u));
+    }
+
+    // An empty range is a no-op
+    {
+        std::vector< unique_int > resources = make_resources(0u);
+        boost::scope::parallel_reset(resources.begin(), resources.end(), 4u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 0u);
+    }
+
+    // The executor overload drives the submitted partitions through the executor
+    {
+        const std::size_t count = 1000u;
+        std::vector< unique_int > resources = make_resources(count);
+
+        unsigned int submitted_count = 0u;
+        std::vector< std::thread > workers;
+        boost::scope::parallel_reset(resources.begin(), resources.end(),
+            [&submitted_count, &workers](std::function< void() > task)
+            {
+                ++submitted_count;
+                workers.emplace_back(std::move(task));
+            },
+            4u);
+        for (std::thread& worker : workers)
+            worker.join();
+
+        BOOST_TEST_EQ(submitted_count, 3u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), count);
+        BOOST_TEST(all_deleted_once(count));
+    }
+
+    // A throwing executor still leaves the range fully released
+    {
+        const std::size_t count = 100u;
+        std::vector< unique_int > resources = make_resources(count);
+
+        bool caught = false;
+        try
+        {
+            boost::scope::parallel_reset(resources.begin(), resources.end(),
+                [](std::function< void() >)
+                {
+                    throw std::bad_alloc();
+                },
+                4u);
+        }
+        catch (std::bad_alloc&)
+        {
+            caught = true;
+        }
+
+        BOOST_TEST(caught);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), count);
+        BOOST_TEST(all_deleted_once(count));
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,93 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   profile.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c BOOST_SCOPE_PROFILE instrumentation.
+ */
+
+#define BOOST_SCOPE_PROFILE
+
+#include <boost/scope/profile.hpp>
+#include <boost/scope/scope_exit.hpp>
+#include <boost/scope/scope_final.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int) const noexcept
+    {
+    }
+};
+
+int main()
+{
+    unsigned int scope_exit_actions = 0u;
+    unsigned int scope_final_actions = 0u;
+    unsigned int unique_resource_deleters = 0u;
+
+    auto visitor = [&](boost::scope::profile_event const& ev)
+    {
+        BOOST_TEST(ev.action != nullptr);
+        BOOST_TEST(ev.action_name != nullptr);
+        switch (ev.kind)
+        {
+        case boost::scope::profile_event_kind::scope_exit_action:
+            ++scope_exit_actions;
+            break;
+        case boost::scope::profile_event_kind::scope_final_action:
+            ++scope_final_actions;
+            break;
+        case boost::scope::profile_event_kind::unique_resource_deleter:
+            ++unique_resource_deleters;
+            break;
+        }
+    };
+
+    // Guard actions and deleters produce one event each
+    {
+        int n = 0;
+        {
+            auto guard = boost::scope::make_scope_exit([&n]() { ++n; });
+            BOOST_SCOPE_FINAL [&n]() { ++n; };
+            boost::scope::unique_resource< int, int_deleter > ur{ 10 };
+        }
+        BOOST_TEST_EQ(n, 2);
+    }
+
+    BOOST_TEST_EQ(boost::scope::drain_profile_events(visitor), 3u);
+    BOOST_TEST_EQ(scope_exit_actions, 1u);
+    BOOST_TEST_EQ(scope_final_actions, 1u);
+    BOOST_TEST_EQ(unique_resource_deleters, 1u);
+
+    // An inactive guard produces no event
+    {
+        auto guard = boost::scope::make_scope_exit([]() {}, false);
+    }
+    BOOST_TEST_EQ(boost::scope::drain_profile_events(visitor), 0u);
+
+    // Events from other threads are drained too
+    {
+        std::thread thr([]()
+        {
+            auto guard = boost::scope::make_scope_exit([]() {});
+        });
+        thr.join();
+    }
+    BOOST_TEST_EQ(boost::scope::drain_profile_events(visitor), 1u);
+    BOOST_TEST_EQ(scope_exit_actions, 2u);
+
+    BOOST_TEST_EQ(boost::scope::profile_events_dropped(), 0u);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,133 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   result_checker.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c result_checker.
+ */
+
+#include <boost/scope/result_checker.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/scope/scope_success.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__has_include)
+#if __has_include(<optional>)
+#include <optional>
+#endif
+#endif
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202l
+#include <expected>
+#endif
+
+//! A minimal result type reporting failure through \c has_value()
+struct test_result
+{
+    bool m_has_value;
+
+    bool has_value() const noexcept
+    {
+        return m_has_value;
+    }
+};
+
+struct increment_action
+{
+    int* m_count;
+
+    void operator() () const noexcept
+    {
+        ++*m_count;
+    }
+};
+
+int main()
+{
+    // The predicate reflects the referenced result object state
+    {
+        test_result res{ true };
+        boost::scope::result_checker< test_result > checker(res);
+        BOOST_TEST(!checker());
+
+        res.m_has_value = false;
+        BOOST_TEST(checker());
+    }
+
+    // scope_fail fires when the result holds an error at scope exit
+    {
+        int count = 0;
+        {
+            test_result res{ true };
+            boost::scope::scope_fail< increment_action, boost::scope::result_checker< test_result > >
+                guard(increment_action{ &count }, boost::scope::check_result(res));
+            res.m_has_value = false;
+        }
+        BOOST_TEST_EQ(count, 1);
+    }
+
+    // scope_fail does not fire when the result holds a value
+    {
+        int count = 0;
+        {
+            test_result res{ false };
+            boost::scope::scope_fail< increment_action, boost::scope::result_checker< test_result > >
+                guard(increment_action{ &count }, boost::scope::check_result(res));
+            res.m_has_value = true;
+        }
+        BOOST_TEST_EQ(count, 0);
+    }
+
+    // scope_success fires only when the result holds a value
+    {
+        int count = 0;
+        {
+            test_result res{ false };
+            boost::scope::scope_success< increment_action, boost::scope::result_checker< test_result > >
+                guard(increment_action{ &count }, boost::scope::check_result(res));
+            res.m_has_value = true;
+        }
+        BOOST_TEST_EQ(count, 1);
+
+        {
+            test_result res{ false };
+            boost::scope::scope_success< increment_action, boost::scope::result_checker< test_result > >
+                guard(increment_action{ &count }, boost::scope::check_result(res));
+        }
+        BOOST_TEST_EQ(count, 1);
+    }
+
+#if defined(__cpp_lib_optional) && __cpp_lib_optional >= 201606l
+    // std::optional works as a result type
+    {
+        int count = 0;
+        {
+            std::optional< int > res;
+            boost::scope::scope_fail< increment_action, boost::scope::result_checker< std::optional< int > > >
+                guard(increment_action{ &count }, boost::scope::check_result(res));
+        }
+        BOOST_TEST_EQ(count, 1);
+    }
+#endif // defined(__cpp_lib_optional) && __cpp_lib_optional >= 201606l
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202l
+    // std::expected works as a result type
+    {
+        int count = 0;
+        {
+            std::expected< int, int > res(std::unexpect, -1);
+            boost::scope::scope_fail< increment_action, boost::scope::result_checker< std::expected< int, int > > >
+                guard(increment_action{ &count }, boost::scope::check_result(res));
+        }
+        BOOST_TEST_EQ(count, 1);
+    }
+#endif
+
+    return boost::report_errors();
+}
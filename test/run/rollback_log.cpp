@@ -0,0 +1,99 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   rollback_log.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c rollback_log.
+ */
+
+#include <boost/scope/rollback_log.hpp>
+#include <boost/scope/error_code_checker.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <stdexcept>
+
+int main()
+{
+    // A committed transaction discards the undo actions
+    {
+        std::vector< int > undone;
+        {
+            boost::scope::rollback_log log;
+            log.push([&undone]() { undone.push_back(1); });
+            log.push([&undone]() { undone.push_back(2); });
+            BOOST_TEST(!log.committed());
+            log.commit();
+            BOOST_TEST(log.committed());
+        }
+        BOOST_TEST_EQ(undone.size(), 0u);
+    }
+
+    // An exception thrown before commit replays the undo actions in reverse
+    {
+        std::vector< int > undone;
+        try
+        {
+            boost::scope::rollback_log log;
+            log.push([&undone]() { undone.push_back(1); });
+            log.push([&undone]() { undone.push_back(2); });
+            log.push([&undone]() { undone.push_back(3); });
+            throw std::runtime_error("transaction failed");
+        }
+        catch (...)
+        {
+        }
+
+        BOOST_TEST_EQ(undone.size(), 3u);
+        BOOST_TEST_EQ(undone[0], 3);
+        BOOST_TEST_EQ(undone[1], 2);
+        BOOST_TEST_EQ(undone[2], 1);
+    }
+
+    // A committed transaction does not roll back even if an exception follows
+    {
+        std::vector< int > undone;
+        try
+        {
+            boost::scope::rollback_log log;
+            log.push([&undone]() { undone.push_back(1); });
+            log.commit();
+            throw std::runtime_error("failure after commit");
+        }
+        catch (...)
+        {
+        }
+
+        BOOST_TEST_EQ(undone.size(), 0u);
+    }
+
+    // Normal completion without an exception does not roll back
+    {
+        std::vector< int > undone;
+        {
+            boost::scope::rollback_log log;
+            log.push([&undone]() { undone.push_back(1); });
+        }
+        BOOST_TEST_EQ(undone.size(), 0u);
+    }
+
+    // Custom failure conditions are supported, e.g. error_code_checker
+    {
+        std::vector< int > undone;
+        int err = 0;
+        {
+            boost::scope::basic_rollback_log< boost::scope::error_code_checker< int > > log(
+                boost::scope::check_error_code(err));
+            log.push([&undone]() { undone.push_back(1); });
+            err = -1;
+        }
+        BOOST_TEST_EQ(undone.size(), 1u);
+    }
+
+    return boost::report_errors();
+}
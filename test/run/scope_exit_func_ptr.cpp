@@ -0,0 +1,100 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   scope_exit_func_ptr.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for the function pointer specialization of \c scope_exit.
+ */
+
+#include <boost/scope/scope_exit.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <utility>
+
+int g_n = 0;
+
+void increment()
+{
+    ++g_n;
+}
+
+void check_basic()
+{
+    g_n = 0;
+    {
+        boost::scope::scope_exit< void (*)() > guard(&increment);
+        BOOST_TEST(guard.active());
+    }
+    BOOST_TEST_EQ(g_n, 1);
+
+    g_n = 0;
+    {
+        boost::scope::scope_exit< void (*)() > guard(&increment);
+        guard.release();
+        BOOST_TEST(!guard.active());
+    }
+    BOOST_TEST_EQ(g_n, 0);
+
+    g_n = 0;
+    {
+        boost::scope::scope_exit< void (*)() > guard(&increment, false);
+        BOOST_TEST(!guard.active());
+    }
+    BOOST_TEST_EQ(g_n, 0);
+}
+
+void check_set_active()
+{
+    g_n = 0;
+    {
+        boost::scope::scope_exit< void (*)() > guard(&increment);
+        guard.set_active(false);
+        BOOST_TEST(!guard.active());
+        guard.set_active(true);
+        BOOST_TEST(guard.active());
+    }
+    BOOST_TEST_EQ(g_n, 1);
+
+    g_n = 0;
+    {
+        boost::scope::scope_exit< void (*)() > guard(&increment, false);
+        BOOST_TEST(!guard.active());
+        guard.set_active(true);
+        BOOST_TEST(guard.active());
+    }
+    BOOST_TEST_EQ(g_n, 1);
+}
+
+void check_move()
+{
+    g_n = 0;
+    {
+        boost::scope::scope_exit< void (*)() > guard1(&increment);
+        boost::scope::scope_exit< void (*)() > guard2 = std::move(guard1);
+        BOOST_TEST(guard2.active());
+        BOOST_TEST(!guard1.active());
+    }
+    BOOST_TEST_EQ(g_n, 1);
+}
+
+void check_size()
+{
+#if defined(BOOST_SCOPE_HAS_TAGGED_FUNCTION_POINTERS)
+    BOOST_TEST_EQ(sizeof(boost::scope::scope_exit< void (*)() >), sizeof(void (*)()));
+#endif
+}
+
+int main()
+{
+    check_basic();
+    check_set_active();
+    check_move();
+    check_size();
+
+    return boost::report_errors();
+}
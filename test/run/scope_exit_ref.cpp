@@ -0,0 +1,111 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   scope_exit_ref.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c scope_exit_ref.
+ */
+
+#include <boost/scope/scope_exit_ref.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+unsigned int g_copy_count = 0u;
+
+//! A large action that records copies and moves
+struct heavyweight_action
+{
+    unsigned int* m_invoked_count;
+    char m_payload[256];
+
+    explicit heavyweight_action(unsigned int* invoked_count) noexcept :
+        m_invoked_count(invoked_count),
+        m_payload{}
+    {
+    }
+
+    heavyweight_action(heavyweight_action const& that) noexcept :
+        m_invoked_count(that.m_invoked_count),
+        m_payload{}
+    {
+        ++g_copy_count;
+    }
+
+    void operator() () const noexcept
+    {
+        ++*m_invoked_count;
+    }
+};
+
+int main()
+{
+    static_assert(sizeof(boost::scope::scope_exit_ref) <= 3u * sizeof(void*),
+        "scope_exit_ref must remain two pointers plus the activity flag");
+
+    // The guard invokes the referenced action without copying it
+    {
+        unsigned int invoked_count = 0u;
+        heavyweight_action action(&invoked_count);
+        {
+            boost::scope::scope_exit_ref guard(action);
+            BOOST_TEST(guard.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+        BOOST_TEST_EQ(g_copy_count, 0u);
+    }
+
+    // Lambdas and const callables are supported
+    {
+        unsigned int invoked_count = 0u;
+        const auto action = [&invoked_count]() { ++invoked_count; };
+        {
+            boost::scope::scope_exit_ref guard(action);
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Deactivation suppresses the action
+    {
+        unsigned int invoked_count = 0u;
+        auto action = [&invoked_count]() { ++invoked_count; };
+        {
+            boost::scope::scope_exit_ref guard(action);
+            guard.set_active(false);
+        }
+        BOOST_TEST_EQ(invoked_count, 0u);
+
+        {
+            boost::scope::scope_exit_ref guard(action, false);
+            BOOST_TEST(!guard.active());
+            guard.set_active(true);
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Moving transfers the action reference and deactivates the source
+    {
+        unsigned int invoked_count = 0u;
+        auto action = [&invoked_count]() { ++invoked_count; };
+        {
+            boost::scope::scope_exit_ref guard1(action);
+            boost::scope::scope_exit_ref guard2(static_cast< boost::scope::scope_exit_ref&& >(guard1));
+            BOOST_TEST(!guard1.active());
+            BOOST_TEST(guard2.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 1u);
+    }
+
+    // Binding to a temporary action must not compile:
+    // boost::scope::scope_exit_ref guard(heavyweight_action(...));
+    static_assert(!std::is_constructible< boost::scope::scope_exit_ref, heavyweight_action&& >::value,
+        "scope_exit_ref must not bind to rvalue actions");
+    static_assert(std::is_constructible< boost::scope::scope_exit_ref, heavyweight_action& >::value,
+        "scope_exit_ref must bind to lvalue actions");
+
+    return boost::report_errors();
+}
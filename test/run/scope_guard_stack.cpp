@@ -0,0 +1,141 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   scope_guard_stack.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c scope_guard_stack.
+ */
+
+#include <boost/scope/scope_guard_stack.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+unsigned int g_destroyed_count = 0u;
+
+//! An action that records its destruction without being invoked
+struct destruction_recorder
+{
+    bool m_invoked;
+
+    destruction_recorder() noexcept : m_invoked(false)
+    {
+    }
+
+    destruction_recorder(destruction_recorder const& that) noexcept : m_invoked(that.m_invoked)
+    {
+    }
+
+    ~destruction_recorder()
+    {
+        ++g_destroyed_count;
+    }
+
+    void operator() () noexcept
+    {
+        m_invoked = true;
+    }
+};
+
+int main()
+{
+    // An empty stack is harmless and allocates nothing
+    {
+        boost::scope::scope_guard_stack stack;
+        BOOST_TEST(stack.active());
+    }
+
+    // Actions run in LIFO order
+    {
+        std::vector< int > order;
+        {
+            boost::scope::scope_guard_stack stack;
+            for (int i = 0; i < 10; ++i)
+            {
+                stack.push([&order, i]() { order.push_back(i); });
+            }
+        }
+
+        BOOST_TEST_EQ(order.size(), 10u);
+        for (unsigned int i = 0u; i < order.size(); ++i)
+            BOOST_TEST_EQ(order[i], static_cast< int >(9u - i));
+    }
+
+    // A deactivated stack destroys the actions without invoking them
+    {
+        g_destroyed_count = 0u;
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::scope_guard_stack stack;
+            stack.push([&invoked_count]() { ++invoked_count; });
+            stack.push(destruction_recorder());
+
+            stack.set_active(false);
+            BOOST_TEST(!stack.active());
+        }
+        BOOST_TEST_EQ(invoked_count, 0u);
+        BOOST_TEST_GE(g_destroyed_count, 1u); // at least the stored copy is destroyed
+    }
+
+    // Many actions force the arena to grow beyond the initial chunk
+    {
+        unsigned int invoked_count = 0u;
+        {
+            boost::scope::scope_guard_stack stack(64u);
+            for (unsigned int i = 0u; i < 1000u; ++i)
+            {
+                stack.push([&invoked_count]() { ++invoked_count; });
+            }
+        }
+        BOOST_TEST_EQ(invoked_count, 1000u);
+    }
+
+    // Actions of heterogeneous types and sizes can be mixed
+    {
+        std::vector< int > order;
+        {
+            boost::scope::scope_guard_stack stack;
+            char big_payload[64] = {};
+            stack.push([&order]() { order.push_back(1); });
+            stack.push([&order, big_payload]() { order.push_back(2 + big_payload[0]); });
+            stack.push([&order]() { order.push_back(3); });
+        }
+
+        BOOST_TEST_EQ(order.size(), 3u);
+        BOOST_TEST_EQ(order[0], 3);
+        BOOST_TEST_EQ(order[1], 2);
+        BOOST_TEST_EQ(order[2], 1);
+    }
+
+    // An over-aligned action pushed near the end of a chunk must open a new
+    // chunk instead of writing past the old one
+    {
+        unsigned int invoked_count = 0u;
+        {
+            struct alignas(64) overaligned_action
+            {
+                unsigned int* m_count;
+
+                void operator() () noexcept
+                {
+                    ++*m_count;
+                }
+            };
+
+            boost::scope::scope_guard_stack stack(64u);
+            for (unsigned int i = 0u; i < 100u; ++i)
+            {
+                stack.push([&invoked_count]() { ++invoked_count; });
+                stack.push(overaligned_action{ &invoked_count });
+            }
+        }
+        BOOST_TEST_EQ(invoked_count, 200u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,112 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   sentinel_resource_traits.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c sentinel_resource_traits.
+ */
+
+#include <boost/scope/sentinel_resource_traits.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+int g_deleted_count = 0;
+int g_last_deleted = 0;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        ++g_deleted_count;
+        g_last_deleted = res;
+    }
+};
+
+enum class handle_id : unsigned int
+{
+    invalid = 0u
+};
+
+unsigned int g_handle_deleted_count = 0u;
+
+struct handle_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (handle_id) const noexcept
+    {
+        ++g_handle_deleted_count;
+    }
+};
+
+int main()
+{
+    // Flag-free storage: the traits must collapse unique_resource to the size of the resource
+    typedef boost::scope::sentinel_resource_traits< int, -1 > int_traits;
+    typedef boost::scope::unique_resource< int, int_deleter, int_traits > unique_int;
+    static_assert(sizeof(unique_int) == sizeof(int), "unique_resource with sentinel_resource_traits must not store an allocated flag");
+
+    BOOST_TEST_EQ(int_traits::make_default(), -1);
+    BOOST_TEST(!int_traits::is_allocated(-1));
+    BOOST_TEST(int_traits::is_allocated(0));
+    BOOST_TEST(int_traits::is_allocated(10));
+
+    {
+        unique_int ur;
+        BOOST_TEST_EQ(ur.get(), -1);
+        BOOST_TEST(!ur.allocated());
+    }
+    BOOST_TEST_EQ(g_deleted_count, 0);
+
+    {
+        unique_int ur(10);
+        BOOST_TEST_EQ(ur.get(), 10);
+        BOOST_TEST(ur.allocated());
+    }
+    BOOST_TEST_EQ(g_deleted_count, 1);
+    BOOST_TEST_EQ(g_last_deleted, 10);
+
+    {
+        unique_int ur(20);
+        ur.release();
+        BOOST_TEST(!ur.allocated());
+    }
+    BOOST_TEST_EQ(g_deleted_count, 1);
+
+    {
+        unique_int ur1(30);
+        unique_int ur2(static_cast< unique_int&& >(ur1));
+        BOOST_TEST(!ur1.allocated());
+        BOOST_TEST(ur2.allocated());
+        BOOST_TEST_EQ(ur2.get(), 30);
+    }
+    BOOST_TEST_EQ(g_deleted_count, 2);
+    BOOST_TEST_EQ(g_last_deleted, 30);
+
+    // Enumeration resources with a sentinel enumerator
+    typedef boost::scope::sentinel_resource_traits< handle_id, handle_id::invalid > handle_traits;
+    typedef boost::scope::unique_resource< handle_id, handle_deleter, handle_traits > unique_handle_id;
+    static_assert(sizeof(unique_handle_id) == sizeof(handle_id), "unique_resource with sentinel_resource_traits must not store an allocated flag");
+
+    {
+        unique_handle_id ur;
+        BOOST_TEST(!ur.allocated());
+    }
+    BOOST_TEST_EQ(g_handle_deleted_count, 0u);
+
+    {
+        unique_handle_id ur(static_cast< handle_id >(42u));
+        BOOST_TEST(ur.allocated());
+    }
+    BOOST_TEST_EQ(g_handle_deleted_count, 1u);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,115 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   sharded_cleanup_scheduler.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c sharded_cleanup_scheduler and
+ *         \c sharded_deferred_deleter.
+ */
+
+#include <boost/scope/sharded_cleanup_scheduler.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+std::atomic< unsigned int > g_deleted_count{ 0u };
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int) const noexcept
+    {
+        g_deleted_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+};
+
+typedef boost::scope::sharded_deferred_deleter< int_deleter > deleter_type;
+
+int main()
+{
+    {
+        boost::scope::sharded_cleanup_scheduler scheduler(4u);
+        BOOST_TEST_EQ(scheduler.shard_count(), 4u);
+        BOOST_TEST_LT(scheduler.this_thread_shard(), 4u);
+    }
+
+    // Deallocation runs on drain of the pinned shard, not on destruction
+    {
+        boost::scope::sharded_cleanup_scheduler scheduler(2u);
+
+        deleter_type del(scheduler, 0u);
+        BOOST_TEST_EQ(del.shard_index(), 0u);
+
+        {
+            boost::scope::unique_resource< int, deleter_type > ur(10, del);
+        }
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 0u);
+
+        BOOST_TEST_EQ(scheduler.drain(0u), 1u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 1u);
+    }
+
+    // The deleter stays pinned to the creating shard even when the resource
+    // is destroyed on another thread
+    {
+        g_deleted_count.store(0u, std::memory_order_relaxed);
+
+        boost::scope::sharded_cleanup_scheduler scheduler(2u);
+        deleter_type del(scheduler, 1u);
+
+        boost::scope::unique_resource< int, deleter_type > ur(20, del);
+        std::thread t([&ur]()
+        {
+            boost::scope::unique_resource< int, deleter_type > inner(static_cast< boost::scope::unique_resource< int, deleter_type >&& >(ur));
+        });
+        t.join();
+
+        BOOST_TEST_EQ(scheduler.drain(1u), 1u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 1u);
+    }
+
+    // Draining an empty shard steals from the others
+    {
+        g_deleted_count.store(0u, std::memory_order_relaxed);
+
+        boost::scope::sharded_cleanup_scheduler scheduler(3u);
+        scheduler.push(0u, 30, int_deleter());
+        scheduler.push(0u, 31, int_deleter());
+
+        BOOST_TEST_EQ(scheduler.drain(2u), 2u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 2u);
+    }
+
+    // drain_all empties every shard
+    {
+        g_deleted_count.store(0u, std::memory_order_relaxed);
+
+        boost::scope::sharded_cleanup_scheduler scheduler(4u);
+        for (std::size_t i = 0u; i < 4u; ++i)
+            scheduler.push(i, static_cast< int >(i), int_deleter());
+
+        BOOST_TEST_EQ(scheduler.drain_all(), 4u);
+        BOOST_TEST_EQ(g_deleted_count.load(std::memory_order_relaxed), 4u);
+    }
+
+    return boost::report_errors();
+}
+
+#else // !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_NO_CXX11_THREAD_LOCAL)
@@ -0,0 +1,136 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   shared_resource.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c shared_resource.
+ */
+
+#include <boost/scope/shared_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <vector>
+
+unsigned int g_deleted_count = 0u;
+int g_last_deleted = 0;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        ++g_deleted_count;
+        g_last_deleted = res;
+    }
+};
+
+typedef boost::scope::shared_resource< int, int_deleter > shared_int;
+
+int main()
+{
+    // An empty wrapper owns nothing
+    {
+        shared_int sr;
+        BOOST_TEST(!sr.allocated());
+    }
+    BOOST_TEST_EQ(g_deleted_count, 0u);
+
+    // The deleter runs once, when the last same-thread copy is dropped
+    {
+        g_deleted_count = 0u;
+        {
+            shared_int sr1{ 10 };
+            BOOST_TEST(sr1.allocated());
+            BOOST_TEST_EQ(sr1.get(), 10);
+
+            shared_int sr2(sr1);
+            shared_int sr3(sr2);
+            BOOST_TEST_EQ(sr3.get(), 10);
+            BOOST_TEST_EQ(g_deleted_count, 0u);
+        }
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 10);
+    }
+
+    // reset() drops the reference early
+    {
+        g_deleted_count = 0u;
+        shared_int sr1{ 20 };
+        shared_int sr2(sr1);
+
+        sr1.reset();
+        BOOST_TEST(!sr1.allocated());
+        BOOST_TEST_EQ(g_deleted_count, 0u);
+
+        sr2.reset();
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 20);
+    }
+
+    // Moving transfers the reference without touching the counts
+    {
+        g_deleted_count = 0u;
+        {
+            shared_int sr1{ 30 };
+            shared_int sr2(static_cast< shared_int&& >(sr1));
+            BOOST_TEST(!sr1.allocated());
+            BOOST_TEST_EQ(sr2.get(), 30);
+        }
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+    }
+
+    // Copies dropped on other threads keep the resource alive as needed
+    {
+        g_deleted_count = 0u;
+        {
+            shared_int sr1{ 40 };
+
+            std::vector< std::thread > threads;
+            for (unsigned int i = 0u; i < 4u; ++i)
+            {
+                // share() takes a reference that may be dropped on the target thread
+                threads.emplace_back([](shared_int sr)
+                {
+                    BOOST_TEST_EQ(sr.get(), 40);
+                },
+                sr1.share());
+            }
+
+            for (std::thread& thread : threads)
+                thread.join();
+
+            BOOST_TEST_EQ(g_deleted_count, 0u);
+            BOOST_TEST_EQ(sr1.get(), 40);
+        }
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 40);
+    }
+
+    // The owner thread can drop all local references while other threads still share
+    {
+        g_deleted_count = 0u;
+        std::thread thr;
+        {
+            shared_int sr1{ 50 };
+            thr = std::thread([](shared_int sr)
+            {
+                BOOST_TEST_EQ(sr.get(), 50);
+            },
+            sr1.share());
+
+            sr1.reset();
+        }
+        thr.join();
+        BOOST_TEST_EQ(g_deleted_count, 1u);
+        BOOST_TEST_EQ(g_last_deleted, 50);
+    }
+
+    return boost::report_errors();
+}
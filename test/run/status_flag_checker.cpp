@@ -0,0 +1,75 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   status_flag_checker.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c status_flag_checker.
+ */
+
+#include <boost/scope/status_flag_checker.hpp>
+#include <boost/scope/scope_fail.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+void check_int_flag()
+{
+    int status = 0;
+    boost::scope::status_flag_checker< int > checker(status);
+    BOOST_TEST(!checker());
+
+    status = -1;
+    BOOST_TEST(checker());
+
+    status = 0;
+    BOOST_TEST(!checker());
+}
+
+void check_bool_flag()
+{
+    bool failed = false;
+    boost::scope::status_flag_checker< bool > checker(failed);
+    BOOST_TEST(!checker());
+
+    failed = true;
+    BOOST_TEST(checker());
+}
+
+void check_scope_fail()
+{
+    unsigned int invoked_count = 0u;
+    int status = 0;
+
+    auto action = [&invoked_count]() noexcept { ++invoked_count; };
+
+    {
+        boost::scope::scope_fail<
+            decltype(action),
+            boost::scope::status_flag_checker< int >
+        > guard{ action, boost::scope::check_status_flag(status) };
+        static_cast< void >(guard);
+    }
+    BOOST_TEST_EQ(invoked_count, 0u);
+
+    {
+        boost::scope::scope_fail<
+            decltype(action),
+            boost::scope::status_flag_checker< int >
+        > guard{ action, boost::scope::check_status_flag(status) };
+        status = -1;
+    }
+    BOOST_TEST_EQ(invoked_count, 1u);
+}
+
+int main()
+{
+    check_int_flag();
+    check_bool_flag();
+    check_scope_fail();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,96 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   thread_exit_guard.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c thread_exit_guard.
+ */
+
+#include <boost/scope/thread_exit_guard.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+
+std::atomic< unsigned int > g_flush_count{ 0u };
+std::atomic< unsigned int > g_trim_count{ 0u };
+
+struct flush_stats_action
+{
+    void operator() () const noexcept
+    {
+        g_flush_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+};
+
+struct trim_arena_action
+{
+    void operator() () const noexcept
+    {
+        g_trim_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+};
+
+//! Simulates a per-request handler that registers the cleanup on every call
+void handle_request()
+{
+    boost::scope::thread_exit_guard< flush_stats_action > guard{ flush_stats_action() };
+}
+
+int main()
+{
+    // The action runs once at thread exit regardless of the number of registrations
+    {
+        std::thread thread([]
+        {
+            for (unsigned int i = 0u; i < 1000u; ++i)
+                handle_request();
+            BOOST_TEST_EQ(g_flush_count.load(std::memory_order_relaxed), 0u);
+        });
+        thread.join();
+        BOOST_TEST_EQ(g_flush_count.load(std::memory_order_relaxed), 1u);
+    }
+
+    // Only the first construction in a thread performs the registration
+    {
+        std::thread thread([]
+        {
+            boost::scope::thread_exit_guard< flush_stats_action > guard1{ flush_stats_action() };
+            boost::scope::thread_exit_guard< flush_stats_action > guard2{ flush_stats_action() };
+            BOOST_TEST(guard1.registered());
+            BOOST_TEST(!guard2.registered());
+        });
+        thread.join();
+        BOOST_TEST_EQ(g_flush_count.load(std::memory_order_relaxed), 2u);
+    }
+
+    // Each thread gets its own registration
+    {
+        std::thread thread1(&handle_request);
+        std::thread thread2(&handle_request);
+        thread1.join();
+        thread2.join();
+        BOOST_TEST_EQ(g_flush_count.load(std::memory_order_relaxed), 4u);
+    }
+
+    // Actions of distinct types occupy separate slots
+    {
+        std::thread thread([]
+        {
+            boost::scope::thread_exit_guard< flush_stats_action > guard1{ flush_stats_action() };
+            boost::scope::thread_exit_guard< trim_arena_action > guard2{ trim_arena_action() };
+            BOOST_TEST(guard1.registered());
+            BOOST_TEST(guard2.registered());
+        });
+        thread.join();
+        BOOST_TEST_EQ(g_flush_count.load(std::memory_order_relaxed), 5u);
+        BOOST_TEST_EQ(g_trim_count.load(std::memory_order_relaxed), 1u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,157 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_epoll_registration.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c unique_epoll_registration.
+ *         The test is a no-op on non-Linux systems.
+ */
+
+#include <boost/scope/unique_epoll_registration.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__linux__)
+
+#include <boost/scope/unique_resource_set.hpp>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+
+//! Tests if the descriptor is open
+bool is_open(int fd)
+{
+    return ::fcntl(fd, F_GETFD) >= 0 || errno != EBADF;
+}
+
+int main()
+{
+    // The resource, the one-byte deleter and padding; no separate allocated flag
+    static_assert(sizeof(boost::scope::unique_epoll_registration) <=
+        sizeof(boost::scope::epoll_registration) + sizeof(int),
+        "unique_epoll_registration must not store a separate allocated flag");
+
+    int epoll_fd = ::epoll_create1(0);
+    BOOST_TEST_GE(epoll_fd, 0);
+
+    // Teardown closes the descriptor; the kernel drops the registration with it
+    {
+        int fds[2];
+        BOOST_TEST_EQ(::pipe(fds), 0);
+
+        {
+            ::epoll_event ev = {};
+            ev.events = EPOLLIN;
+            ev.data.fd = fds[0];
+
+            boost::scope::unique_epoll_registration reg =
+                boost::scope::register_with_epoll(epoll_fd, fds[0], &ev);
+            BOOST_TEST(reg.allocated());
+            BOOST_TEST_EQ(reg.get().epoll_fd, epoll_fd);
+            BOOST_TEST_EQ(reg.get().fd, fds[0]);
+        }
+
+        BOOST_TEST(!is_open(fds[0]));
+        ::close(fds[1]);
+    }
+
+    // Registration failure leaves the wrapper unallocated and the descriptor open
+    {
+        int fds[2];
+        BOOST_TEST_EQ(::pipe(fds), 0);
+
+        ::epoll_event ev = {};
+        ev.events = EPOLLIN;
+
+        boost::scope::unique_epoll_registration reg =
+            boost::scope::register_with_epoll(-1, fds[0], &ev);
+        BOOST_TEST(!reg.allocated());
+        BOOST_TEST(is_open(fds[0]));
+
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
+    // Explicit deregistration removes the interest even when the fd is duplicated
+    {
+        int fds[2];
+        BOOST_TEST_EQ(::pipe(fds), 0);
+        const int dup_fd = ::dup(fds[0]);
+        BOOST_TEST_GE(dup_fd, 0);
+
+        {
+            ::epoll_event ev = {};
+            ev.events = EPOLLIN;
+            ev.data.fd = fds[0];
+
+            boost::scope::unique_epoll_registration reg =
+                boost::scope::register_with_epoll(epoll_fd, fds[0], &ev, true);
+            BOOST_TEST(reg.allocated());
+        }
+
+        BOOST_TEST(!is_open(fds[0]));
+        BOOST_TEST(is_open(dup_fd));
+
+        // The registration is gone: a readable duplicate must not surface events
+        BOOST_TEST_EQ(::write(fds[1], "x", 1u), 1);
+        ::epoll_event out_ev = {};
+        BOOST_TEST_EQ(::epoll_wait(epoll_fd, &out_ev, 1, 0), 0);
+
+        ::close(dup_fd);
+        ::close(fds[1]);
+    }
+
+    // Batched teardown through unique_resource_set closes all descriptors
+    {
+        typedef boost::scope::unique_resource_set<
+            boost::scope::epoll_registration,
+            boost::scope::epoll_registration_deleter,
+            boost::scope::epoll_registration_resource_traits
+        > registration_set;
+
+        int fds[8];
+        {
+            registration_set rs;
+            for (unsigned int i = 0u; i < 4u; ++i)
+            {
+                int pipe_fds[2];
+                BOOST_TEST_EQ(::pipe(pipe_fds), 0);
+                fds[i * 2u] = pipe_fds[0];
+                fds[i * 2u + 1u] = pipe_fds[1];
+
+                ::epoll_event ev = {};
+                ev.events = EPOLLIN;
+                ev.data.fd = pipe_fds[0];
+                BOOST_TEST_EQ(::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, pipe_fds[0], &ev), 0);
+
+                boost::scope::epoll_registration reg = { epoll_fd, pipe_fds[0] };
+                rs.insert(reg);
+            }
+        }
+
+        for (unsigned int i = 0u; i < 4u; ++i)
+        {
+            BOOST_TEST(!is_open(fds[i * 2u]));
+            ::close(fds[i * 2u + 1u]);
+        }
+    }
+
+    ::close(epoll_fd);
+
+    return boost::report_errors();
+}
+
+#else // defined(__linux__)
+
+int main()
+{
+    return 0;
+}
+
+#endif // defined(__linux__)
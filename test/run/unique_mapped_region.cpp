@@ -0,0 +1,83 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_mapped_region.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c unique_mapped_region.
+ *         The test is a no-op on Windows.
+ */
+
+#include <boost/scope/unique_mapped_region.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <cstring>
+
+int main()
+{
+    // The length is stored in the resource, not in a deleter closure
+    static_assert(sizeof(boost::scope::unique_mapped_region) == sizeof(boost::scope::mapped_region),
+        "unique_mapped_region must not store a separate allocated flag");
+
+    {
+        boost::scope::unique_mapped_region region;
+        BOOST_TEST(!region.allocated());
+    }
+
+    {
+        boost::scope::unique_mapped_region region = boost::scope::map_region(
+            4096u, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS);
+        BOOST_TEST(region.allocated());
+        if (region.allocated())
+        {
+            BOOST_TEST_NE(region.get().address, MAP_FAILED);
+            BOOST_TEST_EQ(region.get().size, 4096u);
+
+            std::memset(region.get().address, 0xCC, region.get().size);
+            BOOST_TEST_EQ(static_cast< unsigned char* >(region.get().address)[4095], 0xCC);
+
+            BOOST_TEST(boost::scope::advise_region(region, MADV_SEQUENTIAL));
+        }
+
+        region.reset();
+        BOOST_TEST(!region.allocated());
+    }
+
+    {
+        // Failed mappings produce an inactive resource
+        boost::scope::unique_mapped_region region = boost::scope::map_region(
+            4096u, PROT_READ, MAP_PRIVATE, -1); // file-backed mapping with an invalid fd
+        BOOST_TEST(!region.allocated());
+        BOOST_TEST(!boost::scope::advise_region(region, MADV_NORMAL));
+    }
+
+    {
+        boost::scope::unique_mapped_region region1 = boost::scope::map_region(
+            4096u, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS);
+        BOOST_TEST(region1.allocated());
+        void* const address = region1.get().address;
+
+        boost::scope::unique_mapped_region region2 = static_cast< boost::scope::unique_mapped_region&& >(region1);
+        BOOST_TEST(!region1.allocated());
+        BOOST_TEST(region2.allocated());
+        BOOST_TEST_EQ(region2.get().address, address);
+    }
+
+    return boost::report_errors();
+}
+
+#else // !defined(BOOST_WINDOWS)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_WINDOWS)
@@ -0,0 +1,224 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_resource_map.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c unique_resource_map.
+ */
+
+#include <boost/scope/unique_resource_map.hpp>
+#include <boost/scope/sentinel_resource_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <vector>
+
+std::vector< int > g_deleted;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        g_deleted.push_back(res);
+    }
+};
+
+typedef boost::scope::sentinel_resource_traits< int, -1 > int_resource_traits;
+typedef boost::scope::unique_resource_map< std::uint64_t, int, int_deleter, int_resource_traits > int_resource_map;
+
+unsigned int g_batch_call_count = 0u;
+
+struct batch_int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        g_deleted.push_back(res);
+    }
+
+    result_type operator() (const int* res, std::size_t count) const noexcept
+    {
+        ++g_batch_call_count;
+        for (std::size_t i = 0u; i < count; ++i)
+            g_deleted.push_back(res[i]);
+    }
+};
+
+typedef boost::scope::unique_resource_map< std::uint64_t, int, batch_int_deleter, int_resource_traits > batch_int_resource_map;
+
+bool was_deleted(int res)
+{
+    for (int deleted : g_deleted)
+    {
+        if (deleted == res)
+            return true;
+    }
+    return false;
+}
+
+int main()
+{
+    // Insertion and lookup; teardown releases everything
+    {
+        g_deleted.clear();
+        {
+            int_resource_map rm;
+            BOOST_TEST(rm.empty());
+
+            for (std::uint64_t key = 0u; key < 100u; ++key)
+                rm.insert(key, static_cast< int >(key) + 1000);
+
+            BOOST_TEST_EQ(rm.size(), 100u);
+            for (std::uint64_t key = 0u; key < 100u; ++key)
+            {
+                const int* res = rm.find(key);
+                BOOST_TEST(res != nullptr && *res == static_cast< int >(key) + 1000);
+            }
+
+            BOOST_TEST(rm.find(1000u) == nullptr);
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 100u);
+    }
+
+    // Inserting an existing key releases the previous resource
+    {
+        g_deleted.clear();
+        {
+            int_resource_map rm;
+            rm.insert(5u, 10);
+            rm.insert(5u, 20);
+
+            BOOST_TEST_EQ(rm.size(), 1u);
+            BOOST_TEST_EQ(g_deleted.size(), 1u);
+            BOOST_TEST_EQ(g_deleted[0], 10);
+
+            const int* res = rm.find(5u);
+            BOOST_TEST(res != nullptr && *res == 20);
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 2u);
+    }
+
+    // release() relinquishes ownership without invoking the deleter
+    {
+        g_deleted.clear();
+        {
+            int_resource_map rm;
+            rm.insert(1u, 10);
+            rm.insert(2u, 20);
+            rm.insert(3u, 30);
+
+            BOOST_TEST_EQ(rm.release(2u), 20);
+            BOOST_TEST(rm.find(2u) == nullptr);
+            BOOST_TEST_EQ(rm.size(), 2u);
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 2u);
+        BOOST_TEST(!was_deleted(20));
+    }
+
+    // reset() invokes the deleter immediately and removes the mapping
+    {
+        g_deleted.clear();
+        int_resource_map rm;
+        rm.insert(1u, 10);
+        rm.insert(2u, 20);
+
+        BOOST_TEST(rm.reset(2u));
+        BOOST_TEST_EQ(g_deleted.size(), 1u);
+        BOOST_TEST_EQ(g_deleted[0], 20);
+        BOOST_TEST(rm.find(2u) == nullptr);
+        BOOST_TEST_EQ(rm.size(), 1u);
+
+        // reset() of an absent key is a no-op
+        BOOST_TEST(!rm.reset(100u));
+        BOOST_TEST_EQ(g_deleted.size(), 1u);
+    }
+
+    // Erasure keeps colliding keys reachable (backward shifting, no tombstones)
+    {
+        g_deleted.clear();
+        int_resource_map rm;
+
+        // Drive the table through growth and erase half the keys in between
+        for (std::uint64_t key = 0u; key < 64u; ++key)
+            rm.insert(key, static_cast< int >(key));
+        for (std::uint64_t key = 0u; key < 64u; key += 2u)
+            rm.reset(key);
+        for (std::uint64_t key = 64u; key < 128u; ++key)
+            rm.insert(key, static_cast< int >(key));
+
+        BOOST_TEST_EQ(rm.size(), 96u);
+        for (std::uint64_t key = 1u; key < 64u; key += 2u)
+        {
+            const int* res = rm.find(key);
+            BOOST_TEST(res != nullptr && *res == static_cast< int >(key));
+        }
+        for (std::uint64_t key = 0u; key < 64u; key += 2u)
+            BOOST_TEST(rm.find(key) == nullptr);
+        for (std::uint64_t key = 64u; key < 128u; ++key)
+            BOOST_TEST(rm.find(key) != nullptr);
+    }
+
+    // reset_all() empties the map in one sweep; the map is reusable afterwards
+    {
+        g_deleted.clear();
+        int_resource_map rm;
+        for (std::uint64_t key = 0u; key < 10u; ++key)
+            rm.insert(key, static_cast< int >(key));
+        rm.release(5u);
+
+        rm.reset_all();
+        BOOST_TEST_EQ(g_deleted.size(), 9u);
+        BOOST_TEST(rm.empty());
+        BOOST_TEST(!was_deleted(5));
+
+        rm.insert(1u, 100);
+        BOOST_TEST_EQ(rm.size(), 1u);
+    }
+
+    // Batch-capable deleters release everything with a single invocation
+    {
+        g_deleted.clear();
+        {
+            batch_int_resource_map rm;
+            for (std::uint64_t key = 0u; key < 10u; ++key)
+                rm.insert(key, static_cast< int >(key));
+            rm.release(3u); // released resources must not reach the batch deleter
+
+            // reset() by key still uses the single-resource form
+            rm.reset(7u);
+            BOOST_TEST_EQ(g_batch_call_count, 0u);
+            BOOST_TEST_EQ(g_deleted.size(), 1u);
+        }
+        BOOST_TEST_EQ(g_batch_call_count, 1u);
+        BOOST_TEST_EQ(g_deleted.size(), 9u);
+        BOOST_TEST(!was_deleted(3));
+    }
+
+    // Moving transfers the contents
+    {
+        g_deleted.clear();
+        {
+            int_resource_map rm1;
+            rm1.insert(1u, 10);
+            rm1.insert(2u, 20);
+
+            int_resource_map rm2(static_cast< int_resource_map&& >(rm1));
+            BOOST_TEST(rm1.empty());
+            BOOST_TEST_EQ(rm2.size(), 2u);
+
+            const int* res = rm2.find(1u);
+            BOOST_TEST(res != nullptr && *res == 10);
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 2u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,174 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_resource_set.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c unique_resource_set.
+ */
+
+#include <boost/scope/unique_resource_set.hpp>
+#include <boost/scope/sentinel_resource_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+std::vector< int > g_deleted;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        g_deleted.push_back(res);
+    }
+};
+
+typedef boost::scope::sentinel_resource_traits< int, -1 > int_resource_traits;
+typedef boost::scope::unique_resource_set< int, int_deleter, int_resource_traits > int_resource_set;
+
+unsigned int g_batch_call_count = 0u;
+
+struct batch_int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        g_deleted.push_back(res);
+    }
+
+    result_type operator() (const int* res, std::size_t count) const noexcept
+    {
+        ++g_batch_call_count;
+        for (std::size_t i = 0u; i < count; ++i)
+            g_deleted.push_back(res[i]);
+    }
+};
+
+typedef boost::scope::unique_resource_set< int, batch_int_deleter, int_resource_traits > batch_int_resource_set;
+
+int main()
+{
+    // Insertion returns stable indices; teardown releases everything
+    {
+        g_deleted.clear();
+        {
+            int_resource_set rs;
+            BOOST_TEST(rs.empty());
+
+            for (int i = 0; i < 100; ++i)
+            {
+                const int_resource_set::size_type index = rs.insert(i);
+                BOOST_TEST_EQ(index, static_cast< int_resource_set::size_type >(i));
+            }
+
+            BOOST_TEST_EQ(rs.size(), 100u);
+            BOOST_TEST_EQ(rs[42], 42);
+            BOOST_TEST(rs.allocated(42));
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 100u);
+    }
+
+    // release() relinquishes ownership without invoking the deleter
+    {
+        g_deleted.clear();
+        {
+            int_resource_set rs;
+            rs.insert(10);
+            const int_resource_set::size_type index = rs.insert(20);
+            rs.insert(30);
+
+            BOOST_TEST_EQ(rs.release(index), 20);
+            BOOST_TEST(!rs.allocated(index));
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 2u);
+
+        bool deleted_20 = false;
+        for (int res : g_deleted)
+            deleted_20 |= res == 20;
+        BOOST_TEST(!deleted_20);
+    }
+
+    // reset() invokes the deleter immediately and recycles the slot
+    {
+        g_deleted.clear();
+        {
+            int_resource_set rs;
+            rs.insert(10);
+            const int_resource_set::size_type index = rs.insert(20);
+
+            rs.reset(index);
+            BOOST_TEST_EQ(g_deleted.size(), 1u);
+            BOOST_TEST_EQ(g_deleted[0], 20);
+            BOOST_TEST(!rs.allocated(index));
+
+            // The released slot is recycled by the next insertion
+            BOOST_TEST_EQ(rs.insert(40), index);
+            BOOST_TEST_EQ(rs.size(), 2u);
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 3u);
+    }
+
+    // reset_all() empties the set in one pass and skips empty slots
+    {
+        g_deleted.clear();
+        int_resource_set rs;
+        for (int i = 0; i < 10; ++i)
+            rs.insert(i);
+        rs.release(5u);
+
+        rs.reset_all();
+        BOOST_TEST_EQ(g_deleted.size(), 9u);
+        BOOST_TEST(rs.empty());
+
+        // The set is reusable after reset_all()
+        BOOST_TEST_EQ(rs.insert(100), 0u);
+    }
+
+    // Batch-capable deleters release everything with a single invocation
+    {
+        g_deleted.clear();
+        {
+            batch_int_resource_set rs;
+            for (int i = 0; i < 10; ++i)
+                rs.insert(i);
+            rs.release(3u); // empty slots must not reach the batch deleter
+
+            // reset() by index still uses the single-resource form
+            rs.reset(7u);
+            BOOST_TEST_EQ(g_batch_call_count, 0u);
+            BOOST_TEST_EQ(g_deleted.size(), 1u);
+        }
+        BOOST_TEST_EQ(g_batch_call_count, 1u);
+        BOOST_TEST_EQ(g_deleted.size(), 9u);
+
+        bool deleted_3 = false;
+        for (int res : g_deleted)
+            deleted_3 |= res == 3;
+        BOOST_TEST(!deleted_3);
+    }
+
+    // Moving transfers the contents
+    {
+        g_deleted.clear();
+        {
+            int_resource_set rs1;
+            rs1.insert(10);
+            rs1.insert(20);
+
+            int_resource_set rs2(static_cast< int_resource_set&& >(rs1));
+            BOOST_TEST(rs1.empty());
+            BOOST_TEST_EQ(rs2.size(), 2u);
+            BOOST_TEST_EQ(rs2[0], 10);
+        }
+        BOOST_TEST_EQ(g_deleted.size(), 2u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,130 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   unique_socket.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c unique_socket.
+ *         The test is a no-op on Windows.
+ */
+
+#include <boost/scope/unique_socket.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#if defined(__linux__)
+#include <netinet/in.h>
+#include <fcntl.h>
+#endif
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+unsigned int g_deferred_close_count = 0u;
+
+void deferred_close_handler(int fd)
+{
+    ++g_deferred_close_count;
+    ::close(fd);
+}
+
+int main()
+{
+    static_assert(sizeof(boost::scope::unique_socket) == sizeof(int),
+        "unique_socket must not store a separate allocated flag");
+
+    {
+        boost::scope::unique_socket sock;
+        BOOST_TEST_LT(sock.get(), 0);
+        BOOST_TEST(!sock.allocated());
+    }
+
+    // Sockets with an empty send queue are closed inline even when a handler is registered
+    {
+        BOOST_TEST(boost::scope::set_deferred_socket_close_handler(&deferred_close_handler) == nullptr);
+
+        int fds[2];
+        BOOST_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+        {
+            boost::scope::unique_socket sock1(fds[0]), sock2(fds[1]);
+            BOOST_TEST(sock1.allocated());
+            BOOST_TEST(sock2.allocated());
+        }
+        BOOST_TEST_EQ(g_deferred_close_count, 0u);
+
+        BOOST_TEST(boost::scope::set_deferred_socket_close_handler(nullptr) == &deferred_close_handler);
+    }
+
+#if defined(__linux__)
+    // Sockets with unsent data are handed to the registered handler
+    {
+        int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+        BOOST_TEST_GE(listener, 0);
+
+        sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        BOOST_TEST_EQ(::bind(listener, reinterpret_cast< sockaddr* >(&addr), sizeof(addr)), 0);
+        BOOST_TEST_EQ(::listen(listener, 1), 0);
+
+        socklen_t addr_len = sizeof(addr);
+        BOOST_TEST_EQ(::getsockname(listener, reinterpret_cast< sockaddr* >(&addr), &addr_len), 0);
+
+        int client = ::socket(AF_INET, SOCK_STREAM, 0);
+        BOOST_TEST_GE(client, 0);
+        int sndbuf = 4096;
+        ::setsockopt(client, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+        BOOST_TEST_EQ(::connect(client, reinterpret_cast< sockaddr* >(&addr), sizeof(addr)), 0);
+
+        int server = ::accept(listener, nullptr, nullptr);
+        BOOST_TEST_GE(server, 0);
+
+        // Fill the client send queue without draining the server side
+        BOOST_TEST_EQ(::fcntl(client, F_SETFL, ::fcntl(client, F_GETFL) | O_NONBLOCK), 0);
+        char buf[4096] = {};
+        while (::send(client, buf, sizeof(buf), 0) > 0)
+        {
+        }
+        BOOST_TEST(errno == EAGAIN || errno == EWOULDBLOCK);
+
+        int pending = 0;
+        if (::ioctl(client, SIOCOUTQ, &pending) == 0 && pending > 0)
+        {
+            boost::scope::set_deferred_socket_close_handler(&deferred_close_handler);
+            {
+                boost::scope::unique_socket sock(client);
+            }
+            BOOST_TEST_EQ(g_deferred_close_count, 1u);
+            boost::scope::set_deferred_socket_close_handler(nullptr);
+        }
+        else
+        {
+            // Kernel drained the queue; fall back to an inline close
+            ::close(client);
+        }
+
+        ::close(server);
+        ::close(listener);
+    }
+#endif // defined(__linux__)
+
+    return boost::report_errors();
+}
+
+#else // !defined(BOOST_WINDOWS)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_WINDOWS)
@@ -0,0 +1,113 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * https://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2023 Andrey Semashev
+ */
+/*!
+ * \file   watchdog_deleter.cpp
+ * \author Andrey Semashev
+ *
+ * \brief  This file contains tests for \c watchdog_deleter.
+ */
+
+#include <boost/scope/watchdog_deleter.hpp>
+#include <boost/scope/unique_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+
+unsigned int g_deleted_count = 0u;
+int g_last_deleted = 0;
+
+struct int_deleter
+{
+    typedef void result_type;
+
+    result_type operator() (int res) const noexcept
+    {
+        ++g_deleted_count;
+        g_last_deleted = res;
+    }
+};
+
+unsigned int g_handler_invoked_count = 0u;
+std::uint64_t g_last_duration_ns = 0u;
+
+void slow_deleter_handler(std::uint64_t duration_ns)
+{
+    ++g_handler_invoked_count;
+    g_last_duration_ns = duration_ns;
+}
+
+std::uint64_t histogram_total()
+{
+    std::uint64_t buckets[boost::scope::slow_deleter_histogram_bucket_count];
+    boost::scope::slow_deleter_histogram(buckets);
+
+    std::uint64_t total = 0u;
+    for (unsigned int i = 0u; i < boost::scope::slow_deleter_histogram_bucket_count; ++i)
+        total += buckets[i];
+
+    return total;
+}
+
+int main()
+{
+    typedef boost::scope::watchdog_deleter< int_deleter, 1u > sampled_deleter;
+
+    // The wrapper forwards to the wrapped deleter
+    {
+        boost::scope::unique_resource< int, sampled_deleter > ur{ 10 };
+        BOOST_TEST(ur.allocated());
+    }
+    BOOST_TEST_EQ(g_deleted_count, 1u);
+    BOOST_TEST_EQ(g_last_deleted, 10);
+
+    // With an interval of 1 every invocation lands in the histogram
+    {
+        const std::uint64_t total_before = histogram_total();
+        {
+            boost::scope::unique_resource< int, sampled_deleter > ur{ 20 };
+        }
+        BOOST_TEST_EQ(histogram_total(), total_before + 1u);
+    }
+
+    // A zero threshold makes every sample fire the handler
+    {
+        boost::scope::slow_deleter_handler_t prev = boost::scope::set_slow_deleter_handler(slow_deleter_handler, 0u);
+        BOOST_TEST(prev == nullptr);
+
+        {
+            boost::scope::unique_resource< int, sampled_deleter > ur{ 30 };
+        }
+        BOOST_TEST_EQ(g_handler_invoked_count, 1u);
+
+        prev = boost::scope::set_slow_deleter_handler(nullptr, 0u);
+        BOOST_TEST(prev == &slow_deleter_handler);
+    }
+
+    // With the handler unregistered, samples are still recorded but nothing fires
+    {
+        const std::uint64_t total_before = histogram_total();
+        {
+            boost::scope::unique_resource< int, sampled_deleter > ur{ 40 };
+        }
+        BOOST_TEST_EQ(histogram_total(), total_before + 1u);
+        BOOST_TEST_EQ(g_handler_invoked_count, 1u);
+    }
+
+    // An interval of 4 samples one in four invocations
+    {
+        typedef boost::scope::watchdog_deleter< int_deleter, 4u > coarse_deleter;
+
+        const std::uint64_t total_before = histogram_total();
+        for (unsigned int i = 0u; i < 16u; ++i)
+        {
+            boost::scope::unique_resource< int, coarse_deleter > ur{ 50 };
+        }
+        BOOST_TEST_EQ(histogram_total(), total_before + 4u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,83 @@
+# Copyright 2023 Andrey Semashev
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# https://www.boost.org/LICENSE_1_0.txt)
+#
+# CMake script that generates a single amalgamated header from the Boost.Scope
+# headers. The script is intended to be invoked in script mode:
+#
+#   cmake -D SOURCE_DIR=<repo root> -D OUTPUT_FILE=<path to scope_all.hpp> -P tools/amalgamate.cmake
+#
+# The headers are concatenated in dependency order, with includes of other
+# Boost.Scope headers stripped. Include guards of the individual headers are
+# preserved, so the amalgamated header can coexist with the individual headers
+# in a single translation unit.
+
+if (NOT DEFINED SOURCE_DIR OR NOT DEFINED OUTPUT_FILE)
+    message(FATAL_ERROR "SOURCE_DIR and OUTPUT_FILE must be defined")
+endif()
+
+# Headers listed in dependency order. detail/header.hpp and detail/footer.hpp
+# are emitted once, around the whole amalgamated content.
+set(boost_scope_headers
+    detail/config.hpp
+    detail/type_traits/negation.hpp
+    detail/type_traits/conjunction.hpp
+    detail/type_traits/disjunction.hpp
+    detail/type_traits/is_final.hpp
+    detail/type_traits/is_invocable.hpp
+    detail/type_traits/is_nothrow_invocable.hpp
+    detail/type_traits/is_swappable.hpp
+    detail/type_traits/is_nothrow_swappable.hpp
+    detail/is_not_like.hpp
+    detail/compact_storage.hpp
+    detail/move_or_copy_construct_ref.hpp
+    detail/move_or_copy_assign_ref.hpp
+    detail/uncaught_exception_count.hpp
+    detail/profile.hpp
+    scope_exit.hpp
+    exception_checker.hpp
+    error_code_checker.hpp
+    scope_fail.hpp
+    scope_success.hpp
+    scope_final.hpp
+    unique_resource_fwd.hpp
+    unique_resource.hpp
+    fd_deleter.hpp
+    fd_resource_traits.hpp
+    unique_fd.hpp
+)
+
+set(content "/*\n")
+string(APPEND content " * Distributed under the Boost Software License, Version 1.0.\n")
+string(APPEND content " * (See accompanying file LICENSE_1_0.txt or copy at\n")
+string(APPEND content " * https://www.boost.org/LICENSE_1_0.txt)\n")
+string(APPEND content " *\n")
+string(APPEND content " * Copyright (c) 2023 Andrey Semashev\n")
+string(APPEND content " */\n")
+string(APPEND content "/*!\n")
+string(APPEND content " * \\file scope/scope_all.hpp\n")
+string(APPEND content " *\n")
+string(APPEND content " * This is a generated amalgamation of all Boost.Scope headers. Do not edit.\n")
+string(APPEND content " */\n\n")
+string(APPEND content "#ifndef BOOST_SCOPE_SCOPE_ALL_HPP_INCLUDED_\n")
+string(APPEND content "#define BOOST_SCOPE_SCOPE_ALL_HPP_INCLUDED_\n\n")
+
+file(READ "${SOURCE_DIR}/include/boost/scope/detail/header.hpp" chunk)
+string(APPEND content "${chunk}\n")
+
+foreach(header IN LISTS boost_scope_headers)
+    file(READ "${SOURCE_DIR}/include/boost/scope/${header}" chunk)
+    # Strip includes of other Boost.Scope headers; everything is inlined here
+    string(REGEX REPLACE "[ \t]*#[ \t]*include[ \t]+<boost/scope/[^>]+>[ \t]*\r?\n" "" chunk "${chunk}")
+    string(APPEND content "// ---- boost/scope/${header} ----\n\n")
+    string(APPEND content "${chunk}\n")
+endforeach()
+
+file(READ "${SOURCE_DIR}/include/boost/scope/detail/footer.hpp" chunk)
+string(APPEND content "${chunk}\n")
+
+string(APPEND content "#endif // BOOST_SCOPE_SCOPE_ALL_HPP_INCLUDED_\n")
+
+file(WRITE "${OUTPUT_FILE}" "${content}")
@@ -0,0 +1,49 @@
+#!/bin/sh
+# Copyright 2023 Andrey Semashev
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# https://www.boost.org/LICENSE_1_0.txt)
+#
+# Measures compiler front-end (parse) cost of the individual Boost.Scope
+# headers versus the amalgamated scope_all.hpp header. Usage:
+#
+#   tools/compile_bench.sh [compiler] [amalgamated include dir] [extra flags...]
+#
+# The amalgamated header can be generated with:
+#
+#   cmake -D SOURCE_DIR=. -D OUTPUT_FILE=amalgamated/include/boost/scope/scope_all.hpp -P tools/amalgamate.cmake
+
+CXX="${1:-${CXX:-g++}}"
+AMALGAMATED_DIR="${2:-amalgamated/include}"
+shift 2 2>/dev/null
+EXTRA_FLAGS="$*"
+REPEATS=20
+SRC_DIR="$(dirname "$0")/.."
+
+run_case()
+{
+    name="$1"
+    header="$2"
+    incdir="$3"
+    tu="$(mktemp /tmp/scope_compile_bench_XXXXXX.cpp)"
+    printf '#include <%s>\nint main() { return 0; }\n' "$header" > "$tu"
+    start=$(date +%s%N)
+    i=0
+    while [ "$i" -lt "$REPEATS" ]; do
+        # shellcheck disable=SC2086
+        "$CXX" -std=c++17 -fsyntax-only -I "$SRC_DIR/include" -I "$incdir" $EXTRA_FLAGS "$tu" || exit 1
+        i=$((i + 1))
+    done
+    finish=$(date +%s%N)
+    rm -f "$tu"
+    printf '%-40s %8d ms / %d runs\n' "$name" $(( (finish - start) / 1000000 )) "$REPEATS"
+}
+
+run_case "boost/scope/unique_fd.hpp" "boost/scope/unique_fd.hpp" "$SRC_DIR/include"
+run_case "boost/scope/unique_resource.hpp" "boost/scope/unique_resource.hpp" "$SRC_DIR/include"
+if [ -f "$AMALGAMATED_DIR/boost/scope/scope_all.hpp" ]; then
+    run_case "boost/scope/scope_all.hpp (amalgamated)" "boost/scope/scope_all.hpp" "$AMALGAMATED_DIR"
+else
+    echo "note: $AMALGAMATED_DIR/boost/scope/scope_all.hpp not found; skipping amalgamated case"
+fi